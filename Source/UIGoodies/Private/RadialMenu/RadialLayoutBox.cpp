@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialLayoutBox.h"
+#include "RadialMenu/RadialLayoutBoxSlot.h"
+
+#define LOCTEXT_NAMESPACE "UIGoodies"
+
+URadialLayoutBox::URadialLayoutBox(const FObjectInitializer& Initializer)
+	: Super(Initializer)
+{
+	SetVisibilityInternal(ESlateVisibility::SelfHitTestInvisible);
+}
+
+void URadialLayoutBox::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyRadialLayoutBox.Reset();
+}
+
+TSharedRef<SWidget> URadialLayoutBox::RebuildWidget()
+{
+	MyRadialLayoutBox = SNew(SRadialLayoutBox)
+		.PreferredRadius(PreferredRadius)
+		.StartingAngle(StartingAngle);
+
+	for (UPanelSlot* PanelSlot : Slots)
+	{
+		if (URadialLayoutBoxSlot* TypedSlot = Cast<URadialLayoutBoxSlot>(PanelSlot))
+		{
+			TypedSlot->Parent = this;
+			TypedSlot->BuildSlot(MyRadialLayoutBox.ToSharedRef());
+		}
+	}
+
+	return MyRadialLayoutBox.ToSharedRef();
+}
+
+void URadialLayoutBox::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (!MyRadialLayoutBox.IsValid())
+		return;
+
+	MyRadialLayoutBox->SetStartingAngle(StartingAngle);
+	MyRadialLayoutBox->SetPreferredRadius(PreferredRadius);
+}
+
+void URadialLayoutBox::SetPreferredRadius(float InPreferredRadius)
+{
+	PreferredRadius = InPreferredRadius;
+
+	if (MyRadialLayoutBox.IsValid())
+	{
+		MyRadialLayoutBox->SetPreferredRadius(PreferredRadius);
+	}
+}
+
+void URadialLayoutBox::SetStartingAngle(float InStartingAngle)
+{
+	StartingAngle = InStartingAngle;
+
+	if (MyRadialLayoutBox.IsValid())
+	{
+		MyRadialLayoutBox->SetStartingAngle(StartingAngle);
+	}
+}
+
+UClass* URadialLayoutBox::GetSlotClass() const
+{
+	return URadialLayoutBoxSlot::StaticClass();
+}
+
+void URadialLayoutBox::OnSlotAdded(UPanelSlot* InSlot)
+{
+	// Add the child to the live panel if it already exists
+	if (MyRadialLayoutBox.IsValid())
+	{
+		CastChecked<URadialLayoutBoxSlot>(InSlot)->BuildSlot(MyRadialLayoutBox.ToSharedRef());
+	}
+}
+
+void URadialLayoutBox::OnSlotRemoved(UPanelSlot* InSlot)
+{
+	// Remove the widget from the live slot if it exists.
+	if (MyRadialLayoutBox.IsValid() && InSlot->Content)
+	{
+		TSharedPtr<SWidget> Widget = InSlot->Content->GetCachedWidget();
+		if (Widget.IsValid())
+		{
+			MyRadialLayoutBox->RemoveSlot(Widget.ToSharedRef());
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialLayoutBoxSlot.h"
+
+URadialLayoutBoxSlot::URadialLayoutBoxSlot(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Slot(nullptr)
+{
+    Weight = 1.0f;
+}
+
+void URadialLayoutBoxSlot::SynchronizeProperties()
+{
+    SetWeight(Weight);
+}
+
+void URadialLayoutBoxSlot::BuildSlot(TSharedRef<SRadialLayoutBox> RadialLayoutBox)
+{
+    RadialLayoutBox->AddSlot()
+        .Expose(Slot)
+        .Weight(Weight)
+        [
+            Content == nullptr ? SNullWidget::NullWidget : Content->TakeWidget()
+        ];
+}
+
+void URadialLayoutBoxSlot::ReleaseSlateResources(bool bReleaseChildren)
+{
+    Super::ReleaseSlateResources(bReleaseChildren);
+
+    Slot = nullptr;
+}
+
+#if WITH_EDITOR
+void URadialLayoutBoxSlot::SynchronizeFromTemplate(const UPanelSlot* const TemplateSlot)
+{
+    const ThisClass* const TemplateRadialLayoutBoxSlot = CastChecked<ThisClass>(TemplateSlot);
+    SetWeight(TemplateRadialLayoutBoxSlot->Weight);
+}
+#endif
+
+void URadialLayoutBoxSlot::SetWeight(float InWeight)
+{
+    Weight = InWeight;
+    if (Slot)
+    {
+        Slot->SetWeight(Weight);
+    }
+}
+
+float URadialLayoutBoxSlot::GetWeight()
+{
+    return Slot ? Slot->GetWeight() : Weight;
+}
@@ -5,34 +5,86 @@
 #include "RadialMenu/RadialMenuSlot.h"
 #include "Editor/WidgetCompilerLog.h"
 #include "Slate/SlateBrushAsset.h"
+#include "EnhancedInputComponent.h"
+#include "InputAction.h"
+#include "InputActionValue.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Engine/AssetManager.h"
+#include "Widgets/SOverlay.h"
+#include "Widgets/Layout/SBox.h"
 
 #define LOCTEXT_NAMESPACE "UIGoodies"
 
-#define RADIALMENU_MATERIAL_SELECTEDSECTORANGLE "SelectedSectorAngle"
-#define RADIALMENU_MATERIAL_SELECTORANGLE "SelectorAngle"
-#define RADIALMENU_MATERIAL_SECTORSAMOUNT "SectorsAmount"
 
 URadialMenu::URadialMenu(const FObjectInitializer& Initializer)
 	: Super(Initializer)
+	, EntryWidgetPool(*this)
 {
 	SetVisibilityInternal(ESlateVisibility::SelfHitTestInvisible);
+
+	OverlayFont = FCoreStyle::GetDefaultFontStyle("Bold", 12);
+	PlaceholderBrush.DrawAs = ESlateBrushDrawType::NoDrawType;
 }
 
 void URadialMenu::ReleaseSlateResources(bool bReleaseChildren)
 {
 	Super::ReleaseSlateResources(bReleaseChildren);
 
+	UnbindNavigationAction();
+	StopPopulation();
+	StopDetailUpdate();
+
+	EntryWidgetPool.ReleaseAllSlateResources();
+
+	if (bReleaseChildren && DetailWidget)
+	{
+		DetailWidget->ReleaseSlateResources(bReleaseChildren);
+	}
+
+	DetailBox.Reset();
+
+	if (MyRadialMenu.IsValid())
+	{
+		MyRadialMenu->ReleaseInputProcessor();
+		MyRadialMenu->ReleaseBackgroundMaterial();
+	}
+
 	MyRadialMenu.Reset();
 }
 
 TSharedRef<SWidget> URadialMenu::RebuildWidget()
 {
 	MyRadialMenu = SNew(SRadialMenu)
+		.Tag(GetFName())
 		.PreferredRadius(PreferredRadius)
 		.StartingAngle(StartingAngle)
 		.OnSelectionChanged(SRadialMenu::FOnSelectionChanged::CreateUObject(this, &URadialMenu::HandleOnSelectionChanged))
 		.OnAngleChanged(SRadialMenu::FOnAngleChanged::CreateUObject(this, &URadialMenu::HandleOnAngleChanged))
-		.CursorSpeed(CursorSpeed);
+		.OnSlotClicked(SRadialMenu::FOnSlotClicked::CreateUObject(this, &URadialMenu::HandleOnSlotClicked))
+		.HitTestInnerRadius(HitTestInnerRadius)
+		.HitTestOuterRadius(HitTestOuterRadius)
+		.SelectOnClick(bSelectOnClick)
+		.OverlayFont(OverlayFont)
+		.OverlayColor(OverlayColor)
+		.OverlayArcThickness(OverlayArcThickness)
+		.DisabledSlotTint(DisabledSlotTint)
+		.PlaceholderBrush(&PlaceholderBrush)
+		.CursorSpeed(CursorSpeed)
+		.SelectionHysteresis(SelectionHysteresis)
+		.SectorMagnetism(SectorMagnetism)
+		.SelectionPrediction(SelectionPrediction)
+		.LOD(LOD)
+		.BorderImage(&Background)
+		.StaticBackground(bStaticBackground)
+		.InstanceBackgroundMaterial(!IsDesignTime())
+		.EnableInput(!IsDesignTime())
+		.StickType(StickType)
+		.MouseAsAnalogCursor(bMouseAsAnalogCursor)
+		.AnalogStickEnabled(NavigationAction == nullptr);
+
+	// Sectors are built once for all the slots instead of once per added slot
+	MyRadialMenu->BeginBatchUpdate();
 
 	for (UPanelSlot* PanelSlot : Slots)
 	{
@@ -43,56 +95,798 @@ TSharedRef<SWidget> URadialMenu::RebuildWidget()
 		}
 	}
 
+	MyRadialMenu->SetSlotOverlays(SlotOverlays);
+
+	if (!FilterText.IsEmpty())
+	{
+		ApplyFilter();
+	}
+
+	MyRadialMenu->EndBatchUpdate();
+
+	if (PendingEntrySlots.Num() > 0)
+	{
+		StartPopulation();
+	}
+
 	if (!IsDesignTime())
 	{
-		if (BorderDynamicMaterial == nullptr)
+		if (LOD == ERadialMenuLOD::Full)
+		{
+			BindNavigationAction();
+		}
+	}
+
+	if (!HasDetail())
+		return MyRadialMenu.ToSharedRef();
+
+	// Collapsed until an item gets selected, the detail widget itself is created on the first selection
+	return SNew(SOverlay)
+		+ SOverlay::Slot()
+		[
+			MyRadialMenu.ToSharedRef()
+		]
+		+ SOverlay::Slot()
+		.HAlign(DetailHorizontalAlignment)
+		.VAlign(DetailVerticalAlignment)
+		[
+			SAssignNew(DetailBox, SBox)
+			.Visibility(EVisibility::Collapsed)
+			[
+				DetailWidget ? DetailWidget->TakeWidget() : SNullWidget::NullWidget
+			]
+		];
+}
+
+void URadialMenu::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (!MyRadialMenu.IsValid())
+		return;
+
+#if WITH_EDITOR
+	// A property edited in the designer only updates what depends on it
+	if (!EditedPropertyName.IsNone() && SynchronizeProperty(EditedPropertyName))
+		return;
+#endif
+
+	SynchronizeProperty(NAME_None);
+}
+
+#if WITH_EDITOR
+void URadialMenu::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// The designer copies edits of the template to the preview through FObjectEditorUtils::MigratePropertyValue,
+	// which calls this on the preview as well. Only the preview has a slate widget to synchronize
+	TGuardValue<FName> EditedPropertyGuard(EditedPropertyName, PropertyChangedEvent.GetMemberPropertyName());
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+bool URadialMenu::SynchronizeProperty(FName PropertyName)
+{
+	bool bSynchronized = false;
+
+	// The setters skip unchanged values, so pushing everything only costs the comparisons
+	auto ShouldSynchronize = [PropertyName, &bSynchronized](std::initializer_list<FName> PropertyNames)
 		{
-			UMaterialInstanceDynamic* const ParentMaterialDynamic = Cast<UMaterialInstanceDynamic>(Background.GetResourceObject());
-			if (ParentMaterialDynamic == nullptr)
+			for (const FName Name : PropertyNames)
 			{
-				UMaterialInterface* ParentMaterial = Cast<UMaterialInterface>(Background.GetResourceObject());
-				if (ParentMaterial)
+				if (PropertyName.IsNone() || PropertyName == Name)
 				{
-					BorderDynamicMaterial = UMaterialInstanceDynamic::Create(ParentMaterial, nullptr);
-					Background.SetResourceObject(BorderDynamicMaterial);
+					bSynchronized = true;
+					return true;
+				}
+			}
+			return false;
+		};
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, StartingAngle) }))
+	{
+		MyRadialMenu->SetStartingAngle(StartingAngle);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, bStaticBackground) }))
+	{
+		MyRadialMenu->SetStaticBackground(bStaticBackground);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, Background) }))
+	{
+		MyRadialMenu->SetBorderImage(&Background);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, PreferredRadius) }))
+	{
+		MyRadialMenu->SetPreferredRadius(PreferredRadius);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, bMouseAsAnalogCursor) }))
+	{
+		MyRadialMenu->SetMouseAsAnalogCursor(bMouseAsAnalogCursor);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, CursorSpeed) }))
+	{
+		MyRadialMenu->SetCursorSpeed(CursorSpeed);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, SelectionHysteresis) }))
+	{
+		MyRadialMenu->SetSelectionHysteresis(SelectionHysteresis);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, SectorMagnetism) }))
+	{
+		MyRadialMenu->SetSectorMagnetism(SectorMagnetism);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, SelectionPrediction) }))
+	{
+		MyRadialMenu->SetSelectionPrediction(SelectionPrediction);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, HitTestInnerRadius), GET_MEMBER_NAME_CHECKED(URadialMenu, HitTestOuterRadius) }))
+	{
+		MyRadialMenu->SetHitTestRadius(HitTestInnerRadius, HitTestOuterRadius);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, bSelectOnClick) }))
+	{
+		MyRadialMenu->SetSelectOnClick(bSelectOnClick);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, OverlayFont), GET_MEMBER_NAME_CHECKED(URadialMenu, OverlayColor), GET_MEMBER_NAME_CHECKED(URadialMenu, OverlayArcThickness), GET_MEMBER_NAME_CHECKED(URadialMenu, DisabledSlotTint) }))
+	{
+		MyRadialMenu->SetOverlayStyle(OverlayFont, OverlayColor, OverlayArcThickness, DisabledSlotTint);
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, LOD) }))
+	{
+		MyRadialMenu->SetLOD(LOD);
+		NotifyEntriesLOD();
+	}
+
+	if (ShouldSynchronize({ GET_MEMBER_NAME_CHECKED(URadialMenu, PlaceholderBrush) }))
+	{
+		MyRadialMenu->SetPlaceholderBrush(&PlaceholderBrush);
+
+		// Same brush pointer, its content may have changed
+		if (!PropertyName.IsNone())
+		{
+			MyRadialMenu->Invalidate(EInvalidateWidgetReason::Paint);
+		}
+	}
+
+	return bSynchronized;
+}
+
+namespace DynamicRadialMenuCreateEntryInternal
+{
+	TArray<TSubclassOf<UUserWidget>, TInlineAllocator<4>> RecursiveDetection;
+}
+
+void URadialMenu::Reset(bool bDeleteWidgets)
+{
+	ItemSlots.Reset();
+	bSearchIndexDirty = true;
+	PendingEntrySlots.Reset();
+	StopPopulation();
+
+	// Sectors are rebuilt once instead of after every removed slot
+	if (MyRadialMenu.IsValid())
+	{
+		MyRadialMenu->BeginBatchUpdate();
+	}
+
+	ClearChildren();
+
+	EntryWidgetPool.ReleaseAll(bDeleteWidgets);
+
+	if (MyRadialMenu.IsValid())
+	{
+		MyRadialMenu->ClearChildren();
+		MyRadialMenu->EndBatchUpdate();
+	}
+
+	RequestDetailUpdate();
+}
+
+void URadialMenu::SetItems(const TArray<FRadialMenuItem>& Items)
+{
+	ReconcileItems(Items, nullptr);
+}
+
+void URadialMenu::ApplyModelSnapshot(const FRadialMenuModelSnapshotRef& Snapshot)
+{
+	ReconcileItems(Snapshot->Items, Snapshot->SectorTable);
+}
+
+void URadialMenu::ReconcileItems(const TArray<FRadialMenuItem>& Items, TSharedPtr<const FRadialMenuSectorTable, ESPMode::ThreadSafe> PrecomputedSectors)
+{
+	if (!EntryWidgetClass)
+	{
+		UE_LOG(LogSlate, Warning, TEXT("URadialMenu::ReconcileItems. EntryWidgetClass is not set. %s"), *GetPathName());
+		return;
+	}
+
+	const int32 PreviousSelectedSlot = GetSelectedSlot();
+
+	bSearchIndexDirty = true;
+
+	TSet<FName> ItemKeys;
+	ItemKeys.Reserve(Items.Num());
+	for (const FRadialMenuItem& Item : Items)
+	{
+		ItemKeys.Add(Item.Key);
+	}
+
+	if (MyRadialMenu.IsValid())
+	{
+		MyRadialMenu->BeginBatchUpdate();
+	}
+
+	// Remove the entries whose keys are gone
+	for (int32 SlotIndex = Slots.Num() - 1; SlotIndex >= 0; --SlotIndex)
+	{
+		URadialMenuSlot* ItemSlot = Cast<URadialMenuSlot>(Slots[SlotIndex]);
+		if (ItemSlot == nullptr || ItemSlot->GetItemKey().IsNone() || ItemKeys.Contains(ItemSlot->GetItemKey()))
+			continue;
+
+		ItemSlots.Remove(ItemSlot->GetItemKey());
+
+		UUserWidget* EntryWidget = Cast<UUserWidget>(ItemSlot->Content);
+		RemoveChildAt(SlotIndex);
+
+		if (EntryWidget)
+		{
+			EntryWidgetPool.Release(EntryWidget);
+		}
+	}
+
+	// Entry widgets are created at once, unless the slate widget is live and the population is spread over frames
+	const bool bPopulateProgressively = bProgressivePopulation && MyRadialMenu.IsValid();
+
+	// Update the kept entries and append the new ones
+	for (const FRadialMenuItem& Item : Items)
+	{
+		if (TObjectPtr<URadialMenuSlot>* ExistingSlot = ItemSlots.Find(Item.Key))
+		{
+			if ((*ExistingSlot)->GetItem() != Item)
+			{
+				(*ExistingSlot)->SetItem(Item);
+			}
+			continue;
+		}
+
+		if (bPopulateProgressively)
+		{
+			URadialMenuSlot* NewSlot = AddPlaceholderSlot();
+			NewSlot->SetItem(Item);
+			ItemSlots.Add(Item.Key, NewSlot);
+			PendingEntrySlots.Add(NewSlot);
+			bPendingEntriesSorted = false;
+			continue;
+		}
+
+		UUserWidget* EntryWidget = EntryWidgetPool.GetOrCreateInstance(EntryWidgetClass);
+		if (URadialMenuSlot* NewSlot = Cast<URadialMenuSlot>(AddChild(EntryWidget)))
+		{
+			NewSlot->SetItem(Item);
+			ItemSlots.Add(Item.Key, NewSlot);
+			NotifyEntryLOD(EntryWidget);
+		}
+	}
 
-					BorderDynamicMaterial->SetScalarParameterValue(RADIALMENU_MATERIAL_SECTORSAMOUNT, Slots.Num());
+	// Item slots follow the children added in the designer. Only the out of place slots are moved
+	int32 TargetIndex = 0;
+	while (TargetIndex < Slots.Num())
+	{
+		URadialMenuSlot* TypedSlot = Cast<URadialMenuSlot>(Slots[TargetIndex]);
+		if (TypedSlot && !TypedSlot->GetItemKey().IsNone())
+			break;
+
+		++TargetIndex;
+	}
+
+	TSet<FName> PlacedKeys;
+	PlacedKeys.Reserve(Items.Num());
+
+	// Current index of every slot from the first item slot on, kept up to date by the moves so no slot is searched for
+	TMap<const UPanelSlot*, int32> SlotIndices;
+	SlotIndices.Reserve(Slots.Num() - TargetIndex);
+	for (int32 SlotIndex = TargetIndex; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		SlotIndices.Add(Slots[SlotIndex].Get(), SlotIndex);
+	}
+
+	for (const FRadialMenuItem& Item : Items)
+	{
+		TObjectPtr<URadialMenuSlot>* ItemSlotPtr = ItemSlots.Find(Item.Key);
+		if (ItemSlotPtr == nullptr || PlacedKeys.Contains(Item.Key) || TargetIndex >= Slots.Num())
+			continue;
+
+		PlacedKeys.Add(Item.Key);
+
+		URadialMenuSlot* ItemSlot = ItemSlotPtr->Get();
+		if (Slots[TargetIndex] != ItemSlot)
+		{
+			const int32* CurrentIndexPtr = SlotIndices.Find(ItemSlot);
+			const int32 CurrentIndex = CurrentIndexPtr ? *CurrentIndexPtr : INDEX_NONE;
+
+			if (CurrentIndex > TargetIndex)
+			{
+				Slots.RemoveAt(CurrentIndex);
+				Slots.Insert(ItemSlot, TargetIndex);
+
+				// The slots in between moved one index up
+				for (int32 SlotIndex = TargetIndex; SlotIndex <= CurrentIndex; ++SlotIndex)
+				{
+					SlotIndices[Slots[SlotIndex].Get()] = SlotIndex;
 				}
-				else
+
+				if (MyRadialMenu.IsValid())
 				{
-					BorderDynamicMaterial = nullptr;
+					MyRadialMenu->MoveSlot(CurrentIndex, TargetIndex);
 				}
 			}
 		}
 
-		MyRadialMenu->InitInputProcessor(bMouseAsAnalogCursor, StickType);
+		++TargetIndex;
+	}
+
+	if (MyRadialMenu.IsValid())
+	{
+		if (!FilterText.IsEmpty())
+		{
+			ApplyFilter();
+		}
+		else if (PrecomputedSectors.IsValid())
+		{
+			MyRadialMenu->ApplySectorTable(PrecomputedSectors.ToSharedRef());
+		}
+
+		MyRadialMenu->EndBatchUpdate();
+
+		// The selected entry may have moved, so listeners get its new index
+		const int32 NewSelectedSlot = MyRadialMenu->GetSelectedSlot();
+		if (NewSelectedSlot != PreviousSelectedSlot)
+		{
+			HandleOnSelectionChanged(NewSelectedSlot);
+		}
+		// Same entry, its item may have changed
+		else
+		{
+			RequestDetailUpdate();
+		}
 	}
 
-    return MyRadialMenu.ToSharedRef();
+	if (PendingEntrySlots.Num() > 0)
+	{
+		StartPopulation();
+	}
 }
 
-void URadialMenu::SynchronizeProperties()
+void URadialMenu::Prewarm()
 {
-	Super::SynchronizeProperties();
+	if (PrewarmHandle.IsValid())
+	{
+		PrewarmHandle->CancelHandle();
+		PrewarmHandle.Reset();
+	}
 
-	if (!MyRadialMenu.IsValid())
+	PrewarmReport = FRadialMenuPrewarmReport();
+	PrewarmStartTime = FPlatformTime::Seconds();
+	bPrewarming = true;
+
+	++PrewarmSerial;
+	NumPendingPrewarmPackages = 0;
+
+	PrewarmIcons.Reset();
+
+	for (const UPanelSlot* PanelSlot : Slots)
+	{
+		const URadialMenuSlot* ItemSlot = Cast<URadialMenuSlot>(PanelSlot);
+		if (ItemSlot && !ItemSlot->GetItem().Icon.IsNull())
+		{
+			PrewarmIcons.AddUnique(ItemSlot->GetItem().Icon.ToSoftObjectPath());
+		}
+	}
+
+	if (PrewarmIcons.Num() == 0)
+	{
+		FinishPrewarm();
 		return;
+	}
 
-	MyRadialMenu->SetStartingAngle(StartingAngle);
-	MyRadialMenu->SetBorderImage(&Background);
-	MyRadialMenu->SetPreferredRadius(PreferredRadius);
-	MyRadialMenu->SetMouseAsAnalogCursor(bMouseAsAnalogCursor);
-	MyRadialMenu->SetCursorSpeed(CursorSpeed);
+	if (UAssetManager::IsInitialized())
+	{
+		// Completes right away when every icon is already loaded
+		PrewarmHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(PrewarmIcons, FStreamableDelegate::CreateUObject(this, &URadialMenu::FinishPrewarm));
+	}
+	else
+	{
+		// Stream the packages directly instead of loading them synchronously on the game thread
+		TArray<FName, TInlineAllocator<16>> PackageNames;
+		for (const FSoftObjectPath& IconPath : PrewarmIcons)
+		{
+			if (IconPath.ResolveObject() == nullptr)
+			{
+				PackageNames.AddUnique(IconPath.GetLongPackageFName());
+			}
+		}
+
+		if (PackageNames.Num() == 0)
+		{
+			FinishPrewarm();
+			return;
+		}
+
+		NumPendingPrewarmPackages = PackageNames.Num();
+
+		for (const FName PackageName : PackageNames)
+		{
+			LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateWeakLambda(this, [this, Serial = PrewarmSerial](const FName&, UPackage*, EAsyncLoadingResult::Type)
+				{
+					if (Serial == PrewarmSerial && --NumPendingPrewarmPackages == 0)
+					{
+						FinishPrewarm();
+					}
+				}));
+		}
+	}
 }
 
-namespace DynamicRadialMenuCreateEntryInternal
+void URadialMenu::FinishPrewarm()
 {
-	TArray<TSubclassOf<UUserWidget>, TInlineAllocator<4>> RecursiveDetection;
+	TRACE_CPUPROFILER_EVENT_SCOPE(URadialMenu::FinishPrewarm);
+
+	if (!bPrewarming)
+		return;
+
+	bPrewarming = false;
+
+	PrewarmReport.NumIcons = PrewarmIcons.Num();
+	PrewarmReport.IconLoadMs = (FPlatformTime::Seconds() - PrewarmStartTime) * 1000.0;
+
+	// Glyphs are cached per scale, use the one the menu was last painted at
+	float FontScale = GetCachedGeometry().GetAccumulatedLayoutTransform().GetScale();
+	if (FontScale <= 0.f)
+	{
+		FontScale = 1.f;
+	}
+
+	const double GlyphStartTime = FPlatformTime::Seconds();
+
+	for (const UPanelSlot* PanelSlot : Slots)
+	{
+		const URadialMenuSlot* ItemSlot = Cast<URadialMenuSlot>(PanelSlot);
+		if (ItemSlot == nullptr || ItemSlot->GetItem().Label.IsEmpty())
+			continue;
+
+		const FString Label = ItemSlot->GetItem().Label.ToString();
+		++PrewarmReport.NumLabels;
+
+		for (const FSlateFontInfo& LabelFont : LabelFonts)
+		{
+			PrewarmReport.NumGlyphs += FRadialMenuPrewarm::CacheGlyphs(Label, LabelFont, FontScale);
+		}
+	}
+
+	// Overlay counters only draw digits
+	PrewarmReport.NumGlyphs += FRadialMenuPrewarm::CacheGlyphs(TEXT("0123456789"), OverlayFont, FontScale);
+
+	const double BrushStartTime = FPlatformTime::Seconds();
+	PrewarmReport.GlyphMs = (BrushStartTime - GlyphStartTime) * 1000.0;
+
+	// The live widget may draw the background through a pooled material instance
+	PrewarmReport.NumResolvedBrushes += FRadialMenuPrewarm::ResolveBrush(MyRadialMenu.IsValid() ? *MyRadialMenu->GetBackgroundBrush() : Background) ? 1 : 0;
+	PrewarmReport.NumResolvedBrushes += FRadialMenuPrewarm::ResolveBrush(PlaceholderBrush) ? 1 : 0;
+
+	// The icons of the previous Prewarm were held until now, so the ones shared with this call never unloaded
+	PrewarmedIcons.Reset();
+
+	for (const FSoftObjectPath& IconPath : PrewarmIcons)
+	{
+		UObject* Icon = IconPath.ResolveObject();
+		if (Icon == nullptr)
+		{
+			++PrewarmReport.NumFailedIcons;
+			continue;
+		}
+
+		PrewarmedIcons.Add(Icon);
+
+		FSlateBrush IconBrush;
+		IconBrush.SetResourceObject(Icon);
+
+		PrewarmReport.NumResolvedBrushes += FRadialMenuPrewarm::ResolveBrush(IconBrush) ? 1 : 0;
+	}
+
+	PrewarmReport.BrushMs = (FPlatformTime::Seconds() - BrushStartTime) * 1000.0;
+
+	UE_LOG(LogSlate, Log, TEXT("URadialMenu::Prewarm. %s. %s"), *PrewarmReport.ToString(), *GetPathName());
+
+	OnPrewarmCompletedNative.Broadcast(PrewarmReport);
+
+	if (bBroadcastBlueprintEvents)
+	{
+		OnPrewarmCompleted.Broadcast(PrewarmReport);
+	}
 }
 
-void URadialMenu::Reset(bool bDeleteWidgets)
+URadialMenuSlot* URadialMenu::AddPlaceholderSlot()
+{
+	// Same as UPanelWidget::AddChild, without the content
+	EObjectFlags NewObjectFlags = RF_Transactional;
+	if (HasAnyFlags(RF_Transient))
+	{
+		NewObjectFlags |= RF_Transient;
+	}
+
+	URadialMenuSlot* PlaceholderSlot = NewObject<URadialMenuSlot>(this, GetSlotClass(), NAME_None, NewObjectFlags);
+	PlaceholderSlot->Parent = this;
+
+	Slots.Add(PlaceholderSlot);
+	OnSlotAdded(PlaceholderSlot);
+
+	InvalidateLayoutAndVolatility();
+
+	return PlaceholderSlot;
+}
+
+void URadialMenu::StartPopulation()
+{
+	if (!PopulationTickerHandle.IsValid())
+	{
+		PopulationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URadialMenu::TickPopulation));
+	}
+}
+
+void URadialMenu::StopPopulation()
+{
+	if (PopulationTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PopulationTickerHandle);
+		PopulationTickerHandle.Reset();
+	}
+}
+
+bool URadialMenu::TickPopulation(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(URadialMenu::TickPopulation);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Slots removed since, or given content some other way
+	PendingEntrySlots.RemoveAll([this](const TWeakObjectPtr<URadialMenuSlot>& PendingSlot)
+		{
+			return !PendingSlot.IsValid() || PendingSlot->Parent != this || PendingSlot->Content != nullptr;
+		});
+
+	// Without the slate widget nothing is taken, so the rest is cheap to create at once
+	const double BudgetSeconds = MyRadialMenu.IsValid() ? PopulationBudgetMs / 1000.0 : TNumericLimits<double>::Max();
+
+	if (MyRadialMenu.IsValid())
+	{
+		// Within one slot the order barely changes, so the cursor moving does not sort every frame
+		const int32 CursorSlot = MyRadialMenu->FindSlotAtAngle(MyRadialMenu->GetCurrentAngle());
+
+		if (!bPendingEntriesSorted || PendingEntriesSortSlot != CursorSlot)
+		{
+			// Sort by the distance to the slot centre, so the order is the same anywhere inside of the slot
+			const float SortAngle = CursorSlot != INDEX_NONE ? MyRadialMenu->GetSlotAngle(CursorSlot) : MyRadialMenu->GetCurrentAngle();
+
+			PendingEntrySlots.Sort([SortAngle](const TWeakObjectPtr<URadialMenuSlot>& A, const TWeakObjectPtr<URadialMenuSlot>& B)
+				{
+					return FMath::Abs(FRotator::NormalizeAxis(A->GetAngle() - SortAngle)) > FMath::Abs(FRotator::NormalizeAxis(B->GetAngle() - SortAngle));
+				});
+
+			PendingEntriesSortSlot = CursorSlot;
+			bPendingEntriesSorted = true;
+		}
+	}
+
+	while (PendingEntrySlots.Num() > 0 && EntryWidgetClass)
+	{
+		URadialMenuSlot* PendingSlot = PendingEntrySlots.Pop().Get();
+
+		UUserWidget* EntryWidget = EntryWidgetPool.GetOrCreateInstance(EntryWidgetClass);
+		PendingSlot->SetContent(EntryWidget);
+		PendingSlot->SetItem(PendingSlot->GetItem());
+		NotifyEntryLOD(EntryWidget);
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			break;
+	}
+
+	if (PendingEntrySlots.Num() > 0 && EntryWidgetClass)
+		return true;
+
+	PendingEntrySlots.Reset();
+	PopulationTickerHandle.Reset();
+
+	OnPopulationCompletedNative.Broadcast();
+
+	if (bBroadcastBlueprintEvents)
+	{
+		OnPopulationCompleted.Broadcast();
+	}
+
+	return false;
+}
+
+bool URadialMenu::HasDetail() const
+{
+	return DetailWidgetClass || OnGenerateDetailWidget.IsBound() || OnGenerateDetailWidgetNative.IsBound();
+}
+
+void URadialMenu::RequestDetailUpdate()
+{
+	if (!DetailBox.IsValid())
+		return;
+
+	// Restarted on every change, so sweeping across the entries does not repopulate the widget for each of them
+	StopDetailUpdate();
+
+	if (DetailDelay <= 0.f)
+	{
+		UpdateDetail();
+		return;
+	}
+
+	DetailTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URadialMenu::TickDetail), DetailDelay);
+}
+
+void URadialMenu::StopDetailUpdate()
+{
+	if (DetailTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DetailTickerHandle);
+		DetailTickerHandle.Reset();
+	}
+}
+
+bool URadialMenu::TickDetail(float DeltaTime)
+{
+	DetailTickerHandle.Reset();
+	UpdateDetail();
+	return false;
+}
+
+void URadialMenu::UpdateDetail()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(URadialMenu::UpdateDetail);
+
+	if (!DetailBox.IsValid())
+		return;
+
+	const int32 SelectedSlot = GetSelectedSlot();
+	const URadialMenuSlot* SelectedItemSlot = Slots.IsValidIndex(SelectedSlot) ? Cast<URadialMenuSlot>(Slots[SelectedSlot]) : nullptr;
+
+	if (SelectedItemSlot == nullptr || SelectedItemSlot->GetItemKey().IsNone())
+	{
+		DetailBox->SetVisibility(EVisibility::Collapsed);
+		return;
+	}
+
+	if (DetailWidget == nullptr)
+	{
+		DetailWidget = CreateDetailWidget();
+
+		if (DetailWidget == nullptr)
+		{
+			UE_LOG(LogSlate, Warning, TEXT("URadialMenu::UpdateDetail. The detail widget could not be created. %s"), *GetPathName());
+			return;
+		}
+
+		DetailBox->SetContent(DetailWidget->TakeWidget());
+		bHasDetailItem = false;
+	}
+
+	// Coming back to the entry shown last does not repopulate the widget
+	if (!bHasDetailItem || DetailItem != SelectedItemSlot->GetItem())
+	{
+		DetailItem = SelectedItemSlot->GetItem();
+		bHasDetailItem = true;
+
+		if (DetailWidget->Implements<URadialMenuEntry>())
+		{
+			IRadialMenuEntry::Execute_OnRadialMenuItemSet(DetailWidget, DetailItem);
+		}
+	}
+
+	DetailBox->SetVisibility(EVisibility::SelfHitTestInvisible);
+}
+
+UWidget* URadialMenu::CreateDetailWidget()
+{
+	if (OnGenerateDetailWidgetNative.IsBound())
+	{
+		return OnGenerateDetailWidgetNative.Execute(this);
+	}
+
+	if (OnGenerateDetailWidget.IsBound())
+	{
+		return OnGenerateDetailWidget.Execute();
+	}
+
+	if (DetailWidgetClass)
+	{
+		return CreateWidget<UUserWidget>(this, DetailWidgetClass);
+	}
+
+	return nullptr;
+}
+
+void URadialMenu::SetFilterText(const FString& InFilterText)
+{
+	if (FilterText == InFilterText)
+		return;
+
+	FilterText = InFilterText;
+	ApplyFilter();
+}
+
+void URadialMenu::ClearFilter()
 {
-    MyRadialMenu->ClearChildren();
+	SetFilterText(FString());
+}
+
+void URadialMenu::ApplyFilter()
+{
+	if (!MyRadialMenu.IsValid())
+		return;
+
+	if (FilterText.IsEmpty())
+	{
+		MyRadialMenu->SetSlotMask(TBitArray<>());
+		return;
+	}
+
+	if (bSearchIndexDirty)
+	{
+		TArray<FRadialMenuItem> Items;
+		SearchIndexSlots.Reset();
+
+		for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+		{
+			URadialMenuSlot* ItemSlot = Cast<URadialMenuSlot>(Slots[SlotIndex]);
+			if (ItemSlot && !ItemSlot->GetItemKey().IsNone())
+			{
+				Items.Add(ItemSlot->GetItem());
+				SearchIndexSlots.Add(SlotIndex);
+			}
+		}
+
+		SearchIndex.Build(Items);
+		bSearchIndexDirty = false;
+	}
+
+	TBitArray<> Matches;
+	SearchIndex.Search(FilterText, Matches);
+
+	// Children added in the designer are never filtered out
+	TBitArray<> SlotMask(true, Slots.Num());
+	for (int32 ItemIndex = 0; ItemIndex < SearchIndexSlots.Num(); ++ItemIndex)
+	{
+		SlotMask[SearchIndexSlots[ItemIndex]] = Matches[ItemIndex];
+	}
+
+	MyRadialMenu->SetSlotMask(SlotMask);
+}
+
+FName URadialMenu::GetSelectedItemKey()
+{
+	const int32 SelectedSlot = GetSelectedSlot();
+
+	if (URadialMenuSlot* SelectedItemSlot = Slots.IsValidIndex(SelectedSlot) ? Cast<URadialMenuSlot>(Slots[SelectedSlot]) : nullptr)
+	{
+		return SelectedItemSlot->GetItemKey();
+	}
+	return NAME_None;
 }
 
 int32 URadialMenu::GetSelectedSlot()
@@ -157,6 +951,104 @@ void URadialMenu::SelectSlot(int32 SlotIndex)
 	}
 }
 
+void URadialMenu::SetSlotOverlays(const TArray<FRadialMenuSlotOverlay>& InSlotOverlays)
+{
+	SlotOverlays = InSlotOverlays;
+
+	if (MyRadialMenu.IsValid())
+	{
+		MyRadialMenu->SetSlotOverlays(SlotOverlays);
+	}
+}
+
+void URadialMenu::SetSlotOverlay(int32 SlotIndex, const FRadialMenuSlotOverlay& InSlotOverlay)
+{
+	if (SlotIndex < 0)
+		return;
+
+	if (!SlotOverlays.IsValidIndex(SlotIndex))
+	{
+		SlotOverlays.SetNum(SlotIndex + 1);
+	}
+	SlotOverlays[SlotIndex] = InSlotOverlay;
+
+	if (MyRadialMenu.IsValid())
+	{
+		MyRadialMenu->SetSlotOverlay(SlotIndex, InSlotOverlay);
+	}
+}
+
+int32 URadialMenu::SelectNeighbourSlot(bool bClockwise)
+{
+	if (MyRadialMenu.IsValid())
+	{
+		return MyRadialMenu->SelectNeighbourSlot(bClockwise);
+	}
+	return -1;
+}
+
+int32 URadialMenu::SelectSlotInDirection(ERadialMenuDirection Direction)
+{
+	if (MyRadialMenu.IsValid())
+	{
+		return MyRadialMenu->SelectSlotInDirection(Direction);
+	}
+	return -1;
+}
+
+void URadialMenu::SetLOD(ERadialMenuLOD InLOD)
+{
+	if (LOD == InLOD)
+		return;
+
+	LOD = InLOD;
+
+	NotifyEntriesLOD();
+
+	if (!MyRadialMenu.IsValid())
+		return;
+
+	MyRadialMenu->SetLOD(LOD);
+
+	// Hundreds of menus would otherwise each keep an input binding
+	if (LOD != ERadialMenuLOD::Full)
+	{
+		UnbindNavigationAction();
+	}
+	else if (!IsDesignTime())
+	{
+		BindNavigationAction();
+	}
+}
+
+void URadialMenu::NotifyEntriesLOD()
+{
+	for (UPanelSlot* PanelSlot : Slots)
+	{
+		NotifyEntryLOD(PanelSlot ? PanelSlot->Content : nullptr);
+	}
+}
+
+void URadialMenu::NotifyEntryLOD(UWidget* EntryWidget) const
+{
+	if (EntryWidget && EntryWidget->Implements<URadialMenuEntry>())
+	{
+		IRadialMenuEntry::Execute_OnRadialMenuLODChanged(EntryWidget, LOD);
+	}
+}
+
+void URadialMenu::UpdateLODFromView(float ViewDistance, bool bFocused)
+{
+	if (bFocused)
+	{
+		SetLOD(ERadialMenuLOD::Full);
+	}
+	else
+	{
+		SetLOD(ViewDistance >= MinimalLODDistance ? ERadialMenuLOD::Minimal : ERadialMenuLOD::Reduced);
+	}
+}
+
 UClass* URadialMenu::GetSlotClass() const
 {
 	return URadialMenuSlot::StaticClass();
@@ -164,6 +1056,9 @@ UClass* URadialMenu::GetSlotClass() const
 
 void URadialMenu::OnSlotAdded(UPanelSlot* InSlot)
 {
+	// Slot indices of the search index are shifted
+	bSearchIndexDirty = true;
+
 	// Add the child to the live canvas if it already exists
 	if (MyRadialMenu.IsValid())
 	{
@@ -173,6 +1068,8 @@ void URadialMenu::OnSlotAdded(UPanelSlot* InSlot)
 
 void URadialMenu::OnSlotRemoved(UPanelSlot* InSlot)
 {
+	bSearchIndexDirty = true;
+
 	// Remove the widget from the live slot if it exists.
 	if (MyRadialMenu.IsValid() && InSlot->Content)
 	{
@@ -182,31 +1079,101 @@ void URadialMenu::OnSlotRemoved(UPanelSlot* InSlot)
 			MyRadialMenu->RemoveSlot(Widget.ToSharedRef());
 		}
 	}
+	// Placeholder of a progressive population, its null widget is shared with the other placeholders
+	else if (MyRadialMenu.IsValid())
+	{
+		if (const SRadialMenu::FSlot* SlateSlot = CastChecked<URadialMenuSlot>(InSlot)->GetSlateSlot())
+		{
+			MyRadialMenu->RemoveSlot(SlateSlot);
+		}
+	}
 }
 
 void URadialMenu::HandleOnSelectionChanged(int32 SlotIndex)
 {
+	RequestDetailUpdate();
+
+	OnSelectionChangedNative.Broadcast(SlotIndex);
+
+	if (bBroadcastBlueprintEvents && OnSelectionChanged.IsBound())
+	{
 #if WITH_EDITOR
-	// Slate emit this event from Tick. If broadcast event from tick it freeze the whole Editor UI, so we make async broadcast from GameThread
-	AsyncTask(ENamedThreads::GameThread, [=]()
-		{
-			OnSelectionChanged.Broadcast(SlotIndex);
-		});
+		// Slate emit this event from Tick. If broadcast event from tick it freeze the whole Editor UI, so we make async broadcast from GameThread
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<URadialMenu>(this), SlotIndex]()
+			{
+				if (URadialMenu* This = WeakThis.Get())
+				{
+					This->OnSelectionChanged.Broadcast(SlotIndex);
+				}
+			});
 #else
-	OnSelectionChanged.Broadcast(SlotIndex);
+		OnSelectionChanged.Broadcast(SlotIndex);
 #endif
+	}
+}
+
+void URadialMenu::HandleOnAngleChanged(float Angle)
+{
+	OnAngleChangedNative.Broadcast(Angle);
+}
+
+void URadialMenu::HandleOnSlotClicked(int32 SlotIndex)
+{
+	OnSlotClickedNative.Broadcast(SlotIndex);
 
-	if (IsValid(BorderDynamicMaterial))
+	if (bBroadcastBlueprintEvents)
 	{
-		BorderDynamicMaterial->SetScalarParameterValue(RADIALMENU_MATERIAL_SELECTEDSECTORANGLE, MyRadialMenu->GetSlotAngle(SlotIndex));
+		OnSlotClicked.Broadcast(SlotIndex);
 	}
 }
 
-void URadialMenu::HandleOnAngleChanged(float Angle)
+const FRadialMenuFrameState* URadialMenu::GetFrameState() const
 {
-	if (IsValid(BorderDynamicMaterial))
+	return MyRadialMenu.IsValid() ? &MyRadialMenu->GetFrameState() : nullptr;
+}
+
+void URadialMenu::BindNavigationAction()
+{
+	UnbindNavigationAction();
+
+	if (NavigationAction == nullptr)
+		return;
+
+	APlayerController* PlayerController = GetOwningPlayer();
+	UEnhancedInputComponent* InputComponent = PlayerController ? Cast<UEnhancedInputComponent>(PlayerController->InputComponent) : nullptr;
+
+	if (InputComponent == nullptr)
+	{
+		UE_LOG(LogSlate, Warning, TEXT("URadialMenu::BindNavigationAction. Owning player has no Enhanced Input component. %s"), *GetPathName());
+		return;
+	}
+
+	NavigationInputComponent = InputComponent;
+	NavigationBindingHandles.Add(InputComponent->BindAction(NavigationAction, ETriggerEvent::Triggered, this, &URadialMenu::HandleNavigationAction).GetHandle());
+	NavigationBindingHandles.Add(InputComponent->BindAction(NavigationAction, ETriggerEvent::Completed, this, &URadialMenu::HandleNavigationAction).GetHandle());
+}
+
+void URadialMenu::UnbindNavigationAction()
+{
+	if (UEnhancedInputComponent* InputComponent = NavigationInputComponent.Get())
+	{
+		for (uint32 Handle : NavigationBindingHandles)
+		{
+			InputComponent->RemoveBindingByHandle(Handle);
+		}
+	}
+
+	NavigationBindingHandles.Reset();
+	NavigationInputComponent.Reset();
+}
+
+void URadialMenu::HandleNavigationAction(const FInputActionValue& Value)
+{
+	if (MyRadialMenu.IsValid())
 	{
-		BorderDynamicMaterial->SetScalarParameterValue(RADIALMENU_MATERIAL_SELECTORANGLE, Angle);
+		// Action Y axis points up, the radial menu expects slate space
+		const FVector2D Axis = Value.Get<FVector2D>();
+		MyRadialMenu->SetAnalogValue(FVector2D(Axis.X, -Axis.Y));
 	}
 }
 
@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuInputProcessor.h"
+#include "RadialMenu/RadialMenuInputRecording.h"
+#include "RadialMenu/SRadialMenu.h"
+
+bool FRadialMenuInputProcessor::ProcessAnalogInput(const FKey& Key, float InputAnalogValue)
+{
+	// Cursor is driven from outside (e.g. by an Enhanced Input action)
+	if (!bAnalogStickEnabled)
+		return false;
+
+	const bool bLeftStick = StickType == EAnalogStickType::LeftStick;
+	const FKey& AxisX = bLeftStick ? EKeys::Gamepad_LeftX : EKeys::Gamepad_RightX;
+	const FKey& AxisY = bLeftStick ? EKeys::Gamepad_LeftY : EKeys::Gamepad_RightY;
+
+	if (Key == AxisX)
+	{
+		AnalogValue.X = InputAnalogValue;
+		bHasAnalogInput = true;
+		MarkInput();
+	}
+	else if (Key == AxisY)
+	{
+		AnalogValue.Y = -InputAnalogValue;
+		bHasAnalogInput = true;
+		MarkInput();
+	}
+	else
+	{
+		return false;
+	}
+
+	if (Recorder.IsValid())
+	{
+		Recorder->RecordAnalogAxis(Key, InputAnalogValue);
+	}
+
+	return false;
+}
+
+void FRadialMenuInputProcessor::ProcessAnalogValue(FVector2D InAnalogInput)
+{
+	if (Recorder.IsValid())
+	{
+		Recorder->RecordAnalogValue(InAnalogInput);
+	}
+
+	SetAnalogValue(InAnalogInput);
+}
+
+bool FRadialMenuInputProcessor::ProcessPointerMove(const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.IsTouchEvent())
+	{
+		if (static_cast<int32>(MouseEvent.GetPointerIndex()) != TouchPointerIndex)
+			return false;
+
+		if (Recorder.IsValid())
+		{
+			Recorder->RecordPointerEvent(ERadialMenuRecordedInputType::PointerMove, MouseEvent);
+		}
+
+		bHasTouchInput = true;
+		TouchPosition = MouseEvent.GetScreenSpacePosition();
+		MarkInput();
+
+		return true;
+	}
+
+	if (Recorder.IsValid())
+	{
+		Recorder->RecordPointerEvent(ERadialMenuRecordedInputType::PointerMove, MouseEvent);
+	}
+
+	SetMousePosition(MouseEvent.GetScreenSpacePosition());
+
+	return false;
+}
+
+bool FRadialMenuInputProcessor::ProcessPointerDown(const FPointerEvent& MouseEvent)
+{
+	TSharedPtr<SRadialMenu> PinnedOwner = Owner.Pin();
+	if (!PinnedOwner.IsValid())
+		return false;
+
+	if (Recorder.IsValid())
+	{
+		Recorder->RecordPointerEvent(ERadialMenuRecordedInputType::PointerDown, MouseEvent);
+	}
+
+	if (MouseEvent.IsTouchEvent())
+	{
+		// The end of the tracked touch was lost and the pointer index is reused
+		if (TouchPointerIndex == static_cast<int32>(MouseEvent.GetPointerIndex()))
+		{
+			CancelTouch();
+		}
+
+		// Another finger already drives the menu
+		if (TouchPointerIndex != INDEX_NONE)
+			return false;
+
+		if (!PinnedOwner->HandleTouchStarted(MouseEvent))
+			return false;
+
+		TouchPointerIndex = MouseEvent.GetPointerIndex();
+		bHasTouchInput = true;
+		TouchPosition = MouseEvent.GetScreenSpacePosition();
+		MarkInput();
+
+		return true;
+	}
+
+	MarkInput();
+	PinnedOwner->HandleMouseButtonDown(MouseEvent);
+
+	// The click still reaches the entry widgets and anything drawn over the menu
+	return false;
+}
+
+void FRadialMenuInputProcessor::CancelTouch()
+{
+	TouchPointerIndex = INDEX_NONE;
+	bHasTouchInput = false;
+}
+
+bool FRadialMenuInputProcessor::ProcessPointerUp(const FPointerEvent& MouseEvent)
+{
+	if (!MouseEvent.IsTouchEvent() || static_cast<int32>(MouseEvent.GetPointerIndex()) != TouchPointerIndex)
+		return false;
+
+	if (Recorder.IsValid())
+	{
+		Recorder->RecordPointerEvent(ERadialMenuRecordedInputType::PointerUp, MouseEvent);
+	}
+
+	TouchPointerIndex = INDEX_NONE;
+	bHasTouchInput = false;
+	MarkInput();
+
+	if (TSharedPtr<SRadialMenu> PinnedOwner = Owner.Pin())
+	{
+		PinnedOwner->HandleTouchEnded(MouseEvent);
+	}
+
+	return true;
+}
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuInputRecording.h"
+#include "Input/Events.h"
+#include "Misc/FileHelper.h"
+
+namespace RadialMenuInputRecording
+{
+	static const TCHAR* TypeNames[] = { TEXT("AnalogAxis"), TEXT("AnalogValue"), TEXT("PointerMove"), TEXT("PointerDown"), TEXT("PointerUp") };
+
+	static const TCHAR* Header = TEXT("RadialMenuInput");
+}
+
+FGeometry FRadialMenuInputRecording::MakeMenuGeometry() const
+{
+	return FGeometry::MakeRoot(MenuSize, FSlateLayoutTransform(MenuScale, MenuPosition));
+}
+
+bool FRadialMenuInputRecording::SaveToFile(const FString& FilePath) const
+{
+	using namespace RadialMenuInputRecording;
+
+	FString Csv = FString::Printf(TEXT("%s,%f,%f,%f,%f,%f\n"), Header, MenuSize.X, MenuSize.Y, MenuPosition.X, MenuPosition.Y, MenuScale);
+	Csv += TEXT("Time,Type,Key,Value,X,Y,PointerIndex,Touch\n");
+
+	for (const FRadialMenuRecordedInput& Event : Events)
+	{
+		Csv += FString::Printf(TEXT("%.6f,%s,%s,%f,%f,%f,%d,%d\n"),
+			Event.Time,
+			TypeNames[static_cast<uint8>(Event.Type)],
+			*Event.Key.GetFName().ToString(),
+			Event.Value,
+			Event.Position.X,
+			Event.Position.Y,
+			Event.PointerIndex,
+			Event.bTouch ? 1 : 0);
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *FilePath);
+}
+
+bool FRadialMenuInputRecording::LoadFromFile(const FString& FilePath)
+{
+	FString Csv;
+	if (!FFileHelper::LoadFileToString(Csv, *FilePath))
+		return false;
+
+	return LoadFromString(Csv);
+}
+
+bool FRadialMenuInputRecording::LoadFromString(const FString& Csv)
+{
+	using namespace RadialMenuInputRecording;
+
+	TArray<FString> Lines;
+	Csv.ParseIntoArrayLines(Lines);
+
+	TArray<FString> Columns;
+	if (Lines.Num() < 2 || Lines[0].ParseIntoArray(Columns, TEXT(","), false) != 6 || Columns[0] != Header)
+		return false;
+
+	MenuSize = FVector2D(FCString::Atod(*Columns[1]), FCString::Atod(*Columns[2]));
+	MenuPosition = FVector2D(FCString::Atod(*Columns[3]), FCString::Atod(*Columns[4]));
+	MenuScale = FCString::Atof(*Columns[5]);
+
+	Events.Reset(Lines.Num() - 2);
+
+	// Second line is the column names
+	for (int32 LineIndex = 2; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		if (Lines[LineIndex].ParseIntoArray(Columns, TEXT(","), false) != 8)
+			return false;
+
+		int32 TypeIndex = INDEX_NONE;
+		for (int32 NameIndex = 0; NameIndex < UE_ARRAY_COUNT(TypeNames); ++NameIndex)
+		{
+			if (Columns[1] == TypeNames[NameIndex])
+			{
+				TypeIndex = NameIndex;
+				break;
+			}
+		}
+
+		if (TypeIndex == INDEX_NONE)
+			return false;
+
+		FRadialMenuRecordedInput& Event = Events.AddDefaulted_GetRef();
+		Event.Time = FCString::Atod(*Columns[0]);
+		Event.Type = static_cast<ERadialMenuRecordedInputType>(TypeIndex);
+		Event.Key = FKey(*Columns[2]);
+		Event.Value = FCString::Atof(*Columns[3]);
+		Event.Position = FVector2D(FCString::Atod(*Columns[4]), FCString::Atod(*Columns[5]));
+		Event.PointerIndex = FCString::Atoi(*Columns[6]);
+		Event.bTouch = FCString::Atoi(*Columns[7]) != 0;
+	}
+
+	return true;
+}
+
+FRadialMenuInputRecorder::FRadialMenuInputRecorder(const FGeometry& MenuGeometry)
+	: StartTime(FPlatformTime::Seconds())
+{
+	Recording.MenuSize = MenuGeometry.GetLocalSize();
+	Recording.MenuPosition = MenuGeometry.GetAbsolutePosition();
+	Recording.MenuScale = MenuGeometry.GetAccumulatedLayoutTransform().GetScale();
+}
+
+void FRadialMenuInputRecorder::RecordAnalogAxis(const FKey& Key, float Value)
+{
+	FRadialMenuRecordedInput& Event = AddEvent(ERadialMenuRecordedInputType::AnalogAxis);
+	Event.Key = Key;
+	Event.Value = Value;
+}
+
+void FRadialMenuInputRecorder::RecordAnalogValue(FVector2D Value)
+{
+	AddEvent(ERadialMenuRecordedInputType::AnalogValue).Position = Value;
+}
+
+void FRadialMenuInputRecorder::RecordPointerEvent(ERadialMenuRecordedInputType Type, const FPointerEvent& PointerEvent)
+{
+	FRadialMenuRecordedInput& Event = AddEvent(Type);
+	Event.Key = PointerEvent.GetEffectingButton();
+	Event.Position = PointerEvent.GetScreenSpacePosition();
+	Event.PointerIndex = PointerEvent.GetPointerIndex();
+	Event.bTouch = PointerEvent.IsTouchEvent();
+}
+
+FRadialMenuRecordedInput& FRadialMenuInputRecorder::AddEvent(ERadialMenuRecordedInputType Type)
+{
+	FRadialMenuRecordedInput& Event = Recording.Events.AddDefaulted_GetRef();
+	Event.Time = FPlatformTime::Seconds() - StartTime;
+	Event.Type = Type;
+
+	return Event;
+}
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuInputReplay.h"
+#include "RadialMenu/SRadialMenu.h"
+#include "RadialMenu/RadialMenuInputProcessor.h"
+#include "Input/Events.h"
+
+namespace RadialMenuInputReplay
+{
+	static FPointerEvent MakePointerEvent(const FRadialMenuRecordedInput& Event)
+	{
+		if (Event.bTouch)
+			return FPointerEvent(0, Event.PointerIndex, Event.Position, Event.Position, 1.f, true);
+
+		return FPointerEvent(Event.Position, Event.Position, TSet<FKey>(), Event.Key, 0.f, FModifierKeysState());
+	}
+
+	static void ProcessEvent(FRadialMenuInputProcessor& InputProcessor, const FRadialMenuRecordedInput& Event)
+	{
+		switch (Event.Type)
+		{
+		case ERadialMenuRecordedInputType::AnalogAxis:
+			InputProcessor.ProcessAnalogInput(Event.Key, Event.Value);
+			break;
+		case ERadialMenuRecordedInputType::AnalogValue:
+			InputProcessor.ProcessAnalogValue(Event.Position);
+			break;
+		case ERadialMenuRecordedInputType::PointerMove:
+			InputProcessor.ProcessPointerMove(MakePointerEvent(Event));
+			break;
+		case ERadialMenuRecordedInputType::PointerDown:
+			InputProcessor.ProcessPointerDown(MakePointerEvent(Event));
+			break;
+		case ERadialMenuRecordedInputType::PointerUp:
+			InputProcessor.ProcessPointerUp(MakePointerEvent(Event));
+			break;
+		}
+	}
+}
+
+FString FRadialMenuReplayReport::GetSelectionSequence() const
+{
+	FString Sequence;
+
+	for (const FRadialMenuReplaySelection& Selection : Selections)
+	{
+		if (!Sequence.IsEmpty())
+		{
+			Sequence += TEXT(" ");
+		}
+
+		Sequence += FString::Printf(TEXT("%d:%d"), Selection.Frame, Selection.SelectedSlot);
+	}
+
+	return Sequence;
+}
+
+FString FRadialMenuReplayReport::ToCsv(bool bIncludeCosts) const
+{
+	FString Csv = bIncludeCosts ? TEXT("Frame,Events,SelectedSlot,Angle,CostMs\n") : TEXT("Frame,Events,SelectedSlot,Angle\n");
+
+	for (const FRadialMenuReplayFrame& Frame : Frames)
+	{
+		Csv += FString::Printf(TEXT("%d,%d,%d,%.2f"), Frame.Frame, Frame.NumEvents, Frame.SelectedSlot, Frame.Angle);
+		Csv += bIncludeCosts ? FString::Printf(TEXT(",%.4f\n"), Frame.CostMs) : FString(TEXT("\n"));
+	}
+
+	return Csv;
+}
+
+FRadialMenuReplayReport FRadialMenuInputReplayer::Replay(const TSharedRef<SRadialMenu>& RadialMenu, const FRadialMenuInputRecording& Recording, const FRadialMenuReplaySettings& Settings)
+{
+	using namespace RadialMenuInputReplay;
+
+	FRadialMenuReplayReport Report;
+
+	if (!RadialMenu->GetInputProcessor().IsValid())
+	{
+		RadialMenu->InitInputProcessor(false, EAnalogStickType::LeftStick);
+	}
+
+	FRadialMenuInputProcessor& InputProcessor = *RadialMenu->GetInputProcessor();
+
+	const FGeometry Geometry = Recording.MakeMenuGeometry();
+	const float DeltaTime = FMath::Max(Settings.DeltaTime, UE_KINDA_SMALL_NUMBER);
+	const int32 NumFrames = FMath::CeilToInt32((Recording.GetDuration() + Settings.TrailingTime) / DeltaTime);
+
+	Report.Frames.Reserve(NumFrames);
+
+	// Events of a frame are handled before its tick, like Slate does. The first tick only sets the geometry
+	RadialMenu->Tick(Geometry, 0.0, 0.f);
+
+	int32 SelectedSlot = RadialMenu->GetSelectedSlot();
+	int32 EventIndex = 0;
+
+	for (int32 FrameIndex = 1; FrameIndex <= NumFrames; ++FrameIndex)
+	{
+		const double FrameTime = FrameIndex * static_cast<double>(DeltaTime);
+
+		FRadialMenuReplayFrame& Frame = Report.Frames.AddDefaulted_GetRef();
+		Frame.Frame = FrameIndex;
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		for (; EventIndex < Recording.Events.Num() && Recording.Events[EventIndex].Time <= FrameTime; ++EventIndex)
+		{
+			ProcessEvent(InputProcessor, Recording.Events[EventIndex]);
+			++Frame.NumEvents;
+
+			// Clicks select right away, before the tick
+			if (RadialMenu->GetSelectedSlot() != SelectedSlot)
+			{
+				SelectedSlot = RadialMenu->GetSelectedSlot();
+				Report.Selections.Add({ FrameIndex, SelectedSlot });
+			}
+		}
+
+		InputProcessor.UpdateMouseAsAnalogCursor();
+		RadialMenu->Tick(Geometry, FrameTime, DeltaTime);
+
+		Frame.CostMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		Frame.SelectedSlot = RadialMenu->GetSelectedSlot();
+		Frame.Angle = RadialMenu->GetCurrentAngle();
+
+		if (Frame.SelectedSlot != SelectedSlot)
+		{
+			SelectedSlot = Frame.SelectedSlot;
+			Report.Selections.Add({ FrameIndex, SelectedSlot });
+		}
+
+		Report.TotalCostMs += Frame.CostMs;
+		Report.MaxCostMs = FMath::Max(Report.MaxCostMs, Frame.CostMs);
+	}
+
+	return Report;
+}
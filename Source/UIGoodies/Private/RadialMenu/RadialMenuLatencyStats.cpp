@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuLatencyStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "SlateGlobals.h"
+
+CSV_DEFINE_CATEGORY(RadialMenu, true);
+
+TRACE_DECLARE_FLOAT_COUNTER(RadialMenuInputToVisible, TEXT("RadialMenu/InputToVisibleMs"));
+TRACE_DECLARE_INT_COUNTER(RadialMenuInputToVisibleFrames, TEXT("RadialMenu/InputToVisibleFrames"));
+
+static FAutoConsoleCommand DumpRadialMenuLatencyCommand(
+	TEXT("RadialMenu.DumpLatency"),
+	TEXT("Log input to visible latency percentiles of every radial menu and write the histograms to the profiling directory"),
+	FConsoleCommandDelegate::CreateStatic(&FRadialMenuLatencyStats::DumpAll));
+
+FRadialMenuLatencyStats::FRadialMenuLatencyStats(FName InMenuName)
+	: MenuName(InMenuName)
+{
+	Buckets.SetNumZeroed(NumBuckets);
+	GetRegistry().Add(this);
+}
+
+FRadialMenuLatencyStats::~FRadialMenuLatencyStats()
+{
+	GetRegistry().RemoveSingleSwap(this);
+}
+
+void FRadialMenuLatencyStats::AddSample(const FRadialMenuLatencySample& Sample)
+{
+	const double InputToVisibleMs = (Sample.VisibleTime - Sample.InputTime) * 1000.0;
+	const uint64 InputToVisibleFrames = Sample.VisibleFrame - Sample.InputFrame;
+
+	++NumSamples;
+	TotalInputToSelectionMs += (Sample.SelectionTime - Sample.InputTime) * 1000.0;
+	TotalSelectionToBroadcastMs += (Sample.BroadcastTime - Sample.SelectionTime) * 1000.0;
+	TotalInputToVisibleMs += InputToVisibleMs;
+	TotalInputToVisibleFrames += InputToVisibleFrames;
+	MaxInputToVisibleMs = FMath::Max(MaxInputToVisibleMs, InputToVisibleMs);
+
+	++Buckets[FMath::Clamp(FMath::FloorToInt32(InputToVisibleMs), 0, NumBuckets - 1)];
+
+	TRACE_COUNTER_SET(RadialMenuInputToVisible, InputToVisibleMs);
+	TRACE_COUNTER_SET(RadialMenuInputToVisibleFrames, InputToVisibleFrames);
+	CSV_CUSTOM_STAT(RadialMenu, InputToVisibleMs, InputToVisibleMs, ECsvCustomStatOp::Max);
+	CSV_CUSTOM_STAT(RadialMenu, InputToVisibleFrames, static_cast<int32>(InputToVisibleFrames), ECsvCustomStatOp::Max);
+}
+
+void FRadialMenuLatencyStats::Reset()
+{
+	Buckets.Init(0, NumBuckets);
+
+	NumSamples = 0;
+	TotalInputToSelectionMs = 0.0;
+	TotalSelectionToBroadcastMs = 0.0;
+	TotalInputToVisibleMs = 0.0;
+	TotalInputToVisibleFrames = 0;
+	MaxInputToVisibleMs = 0.0;
+}
+
+double FRadialMenuLatencyStats::GetPercentileMs(float Percentile) const
+{
+	if (NumSamples == 0)
+		return 0.0;
+
+	const int32 TargetCount = FMath::Max(1, FMath::CeilToInt32(FMath::Clamp(Percentile, 0.f, 1.f) * NumSamples));
+
+	int32 Count = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		Count += Buckets[BucketIndex];
+		if (Count >= TargetCount)
+		{
+			// Upper bound of the bucket, the overflow bucket reports the slowest sample
+			return BucketIndex == NumBuckets - 1 ? MaxInputToVisibleMs : BucketIndex + 1.0;
+		}
+	}
+
+	return MaxInputToVisibleMs;
+}
+
+void FRadialMenuLatencyStats::WriteCsvRows(FString& OutCsv) const
+{
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		if (Buckets[BucketIndex] > 0)
+		{
+			OutCsv += FString::Printf(TEXT("%s,%d,%u\n"), *MenuName.ToString(), BucketIndex, Buckets[BucketIndex]);
+		}
+	}
+}
+
+void FRadialMenuLatencyStats::DumpAll()
+{
+	FString Csv = TEXT("Menu,InputToVisibleMs,Samples\n");
+
+	for (const FRadialMenuLatencyStats* Stats : GetRegistry())
+	{
+		if (Stats->NumSamples == 0)
+			continue;
+
+		UE_LOG(LogSlate, Display, TEXT("RadialMenu %s: %d selections, input to visible p50 %.1f ms, p99 %.1f ms, max %.1f ms, avg %.2f frames (input to selection %.2f ms, selection to broadcast %.2f ms)"),
+			*Stats->MenuName.ToString(),
+			Stats->NumSamples,
+			Stats->GetPercentileMs(0.5f),
+			Stats->GetPercentileMs(0.99f),
+			Stats->MaxInputToVisibleMs,
+			static_cast<double>(Stats->TotalInputToVisibleFrames) / Stats->NumSamples,
+			Stats->TotalInputToSelectionMs / Stats->NumSamples,
+			Stats->TotalSelectionToBroadcastMs / Stats->NumSamples);
+
+		Stats->WriteCsvRows(Csv);
+	}
+
+	const FString FilePath = FPaths::ProfilingDir() / FString::Printf(TEXT("RadialMenuLatency-%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Csv, *FilePath))
+	{
+		UE_LOG(LogSlate, Display, TEXT("RadialMenu latency histograms written to %s"), *FilePath);
+	}
+}
+
+TArray<FRadialMenuLatencyStats*>& FRadialMenuLatencyStats::GetRegistry()
+{
+	static TArray<FRadialMenuLatencyStats*> Registry;
+	return Registry;
+}
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuLayoutCache.h"
+
+namespace RadialMenuLayoutCache
+{
+	/** Stale entries are removed when the map grows past this, then it is doubled */
+	static int32 PruneThreshold = 64;
+}
+
+FRadialMenuSectorTableRef FRadialMenuLayoutCache::FindOrBuild(TArrayView<const float> Weights, float StartingAngle)
+{
+	check(IsInGameThread());
+
+	FLayoutMap& Layouts = GetLayouts();
+
+	const uint32 KeyHash = HashLayout(Weights, StartingAngle);
+	if (TWeakPtr<const FRadialMenuSectorTable, ESPMode::ThreadSafe>* CachedLayout = Layouts.FindByHash(KeyHash, FLayoutKeyView{ Weights, StartingAngle }))
+	{
+		if (TSharedPtr<const FRadialMenuSectorTable, ESPMode::ThreadSafe> PinnedLayout = CachedLayout->Pin())
+		{
+			return PinnedLayout.ToSharedRef();
+		}
+	}
+
+	TSharedRef<FRadialMenuSectorTable, ESPMode::ThreadSafe> Layout = MakeShared<FRadialMenuSectorTable, ESPMode::ThreadSafe>();
+	Layout->Build(Weights, StartingAngle);
+
+	if (Layouts.Num() >= RadialMenuLayoutCache::PruneThreshold)
+	{
+		RemoveStaleLayouts();
+		RadialMenuLayoutCache::PruneThreshold = FMath::Max(64, Layouts.Num() * 2);
+	}
+
+	FLayoutKey Key;
+	Key.Weights = Weights;
+	Key.StartingAngle = StartingAngle;
+
+	Layouts.AddByHash(KeyHash, MoveTemp(Key), TWeakPtr<const FRadialMenuSectorTable, ESPMode::ThreadSafe>(Layout));
+
+	return Layout;
+}
+
+int32 FRadialMenuLayoutCache::GetNumLayouts()
+{
+	RemoveStaleLayouts();
+	return GetLayouts().Num();
+}
+
+FRadialMenuLayoutCache::FLayoutMap& FRadialMenuLayoutCache::GetLayouts()
+{
+	static FLayoutMap Layouts;
+	return Layouts;
+}
+
+void FRadialMenuLayoutCache::RemoveStaleLayouts()
+{
+	for (FLayoutMap::TIterator It = GetLayouts().CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuLayoutKernel.h"
+#include "RadialMenu/RadialMenuCore.h"
+#include "Math/VectorRegister.h"
+
+namespace RadialMenuLayoutKernel
+{
+	static constexpr int32 Lanes = 4;
+
+	void ComputeDirections(const float* Angles, float* OutDirectionsX, float* OutDirectionsY, int32 Num)
+	{
+		// Slate Y points down, so the direction is (cos(-Angle), sin(-Angle))
+		const VectorRegister4Float NegativeDegreesToRadians = VectorSetFloat1(-UE_PI / 180.f);
+
+		int32 Index = 0;
+		for (; Index + Lanes <= Num; Index += Lanes)
+		{
+			const VectorRegister4Float Radians = VectorMultiply(VectorLoad(Angles + Index), NegativeDegreesToRadians);
+
+			VectorRegister4Float Sin;
+			VectorRegister4Float Cos;
+			VectorSinCos(&Sin, &Cos, &Radians);
+
+			VectorStore(Cos, OutDirectionsX + Index);
+			VectorStore(Sin, OutDirectionsY + Index);
+		}
+
+		RadialMenuCore::ComputeDirections(Angles + Index, OutDirectionsX + Index, OutDirectionsY + Index, Num - Index);
+	}
+
+	void PlaceSlots(const float* DirectionsX, const float* DirectionsY, const float* SizesX, const float* SizesY, float Radius, float MiddlePointOffset, float* OutOffsetsX, float* OutOffsetsY, int32 Num)
+	{
+		const VectorRegister4Float VRadius = VectorSetFloat1(Radius);
+		const VectorRegister4Float VMiddlePointOffset = VectorSetFloat1(MiddlePointOffset);
+		const VectorRegister4Float VHalf = VectorSetFloat1(0.5f);
+
+		int32 Index = 0;
+		for (; Index + Lanes <= Num; Index += Lanes)
+		{
+			const VectorRegister4Float HalfSizeX = VectorMultiply(VectorLoad(SizesX + Index), VHalf);
+			const VectorRegister4Float HalfSizeY = VectorMultiply(VectorLoad(SizesY + Index), VHalf);
+
+			// The nearest side of the child touches the circle from the inside
+			const VectorRegister4Float Distance = VectorSubtract(VRadius, VectorMin(HalfSizeX, HalfSizeY));
+
+			const VectorRegister4Float OffsetX = VectorMultiplyAdd(Distance, VectorLoad(DirectionsX + Index), VectorSubtract(VMiddlePointOffset, HalfSizeX));
+			const VectorRegister4Float OffsetY = VectorMultiplyAdd(Distance, VectorLoad(DirectionsY + Index), VectorSubtract(VMiddlePointOffset, HalfSizeY));
+
+			VectorStore(OffsetX, OutOffsetsX + Index);
+			VectorStore(OffsetY, OutOffsetsY + Index);
+		}
+
+		RadialMenuCore::PlaceSlots(DirectionsX + Index, DirectionsY + Index, SizesX + Index, SizesY + Index, Radius, MiddlePointOffset, OutOffsetsX + Index, OutOffsetsY + Index, Num - Index);
+	}
+}
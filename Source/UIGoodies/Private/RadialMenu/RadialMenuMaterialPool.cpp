@@ -0,0 +1,254 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuMaterialPool.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "SlateGlobals.h"
+#include "UObject/GCObject.h"
+#include "UObject/Package.h"
+
+TRACE_DECLARE_INT_COUNTER(RadialMenuLiveMaterials, TEXT("RadialMenu/LiveMaterials"));
+TRACE_DECLARE_INT_COUNTER(RadialMenuPooledMaterials, TEXT("RadialMenu/PooledMaterials"));
+TRACE_DECLARE_INT_COUNTER(RadialMenuSharedMaterials, TEXT("RadialMenu/SharedMaterials"));
+
+static int32 GRadialMenuMaterialPoolSize = 8;
+static FAutoConsoleVariableRef CVarRadialMenuMaterialPoolSize(
+	TEXT("RadialMenu.MaterialPoolSize"),
+	GRadialMenuMaterialPoolSize,
+	TEXT("Released background material instances kept per parent material"));
+
+static FAutoConsoleCommand DumpRadialMenuMaterialsCommand(
+	TEXT("RadialMenu.DumpMaterials"),
+	TEXT("Log the live, pooled and shared background material instances of the radial menus"),
+	FConsoleCommandDelegate::CreateStatic(&FRadialMenuMaterialPool::DumpStats));
+
+namespace RadialMenuMaterialPool
+{
+	struct FPooledMaterials
+	{
+		TObjectPtr<UMaterialInterface> ParentMaterial;
+		TArray<TObjectPtr<UMaterialInstanceDynamic>> Instances;
+	};
+
+	struct FSharedMaterial
+	{
+		TObjectPtr<UMaterialInterface> ParentMaterial;
+		FName ParameterName;
+		float ParameterValue = 0.f;
+		TObjectPtr<UMaterialInstanceDynamic> Instance;
+		int32 NumUsers = 0;
+	};
+
+	/** Keeps the pooled and shared instances alive, live ones are referenced by their menu */
+	class FState : public FGCObject
+	{
+	public:
+		TArray<FPooledMaterials> Pooled;
+		TArray<FSharedMaterial> Shared;
+		int32 NumLive = 0;
+		int32 NumPooled = 0;
+
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			for (FPooledMaterials& Entry : Pooled)
+			{
+				Collector.AddReferencedObject(Entry.ParentMaterial);
+				Collector.AddReferencedObjects(Entry.Instances);
+			}
+
+			for (FSharedMaterial& Entry : Shared)
+			{
+				Collector.AddReferencedObject(Entry.ParentMaterial);
+				Collector.AddReferencedObject(Entry.Instance);
+			}
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("FRadialMenuMaterialPool");
+		}
+
+		void UpdateCounters() const
+		{
+			TRACE_COUNTER_SET(RadialMenuLiveMaterials, NumLive);
+			TRACE_COUNTER_SET(RadialMenuPooledMaterials, NumPooled);
+			TRACE_COUNTER_SET(RadialMenuSharedMaterials, Shared.Num());
+		}
+	};
+
+	static TUniquePtr<FState> State;
+
+	static FState& GetState()
+	{
+		check(IsInGameThread());
+
+		if (!State.IsValid())
+		{
+			State = MakeUnique<FState>();
+		}
+		return *State;
+	}
+}
+
+UMaterialInstanceDynamic* FRadialMenuMaterialPool::Acquire(UMaterialInterface* ParentMaterial)
+{
+	using namespace RadialMenuMaterialPool;
+
+	if (ParentMaterial == nullptr)
+		return nullptr;
+
+	FState& PoolState = GetState();
+
+	UMaterialInstanceDynamic* Material = nullptr;
+
+	if (FPooledMaterials* Entry = PoolState.Pooled.FindByPredicate([ParentMaterial](const FPooledMaterials& Pooled) { return Pooled.ParentMaterial == ParentMaterial; }))
+	{
+		while (Entry->Instances.Num() > 0 && Material == nullptr)
+		{
+			Material = Entry->Instances.Pop();
+			--PoolState.NumPooled;
+
+			// Instances can be marked as garbage from outside, e.g. by a level transition
+			if (!IsValid(Material))
+			{
+				Material = nullptr;
+			}
+		}
+	}
+
+	if (Material == nullptr)
+	{
+		Material = UMaterialInstanceDynamic::Create(ParentMaterial, GetTransientPackage());
+	}
+
+	++PoolState.NumLive;
+	PoolState.UpdateCounters();
+
+	return Material;
+}
+
+void FRadialMenuMaterialPool::Release(UMaterialInstanceDynamic* Material)
+{
+	using namespace RadialMenuMaterialPool;
+
+	// Menus destroyed after the module shut down have nothing to release into
+	if (Material == nullptr || !State.IsValid())
+		return;
+
+	FState& PoolState = GetState();
+	--PoolState.NumLive;
+
+	UMaterialInterface* ParentMaterial = Material->Parent;
+
+	FPooledMaterials* Entry = PoolState.Pooled.FindByPredicate([ParentMaterial](const FPooledMaterials& Pooled) { return Pooled.ParentMaterial == ParentMaterial; });
+	if (Entry == nullptr)
+	{
+		Entry = &PoolState.Pooled.AddDefaulted_GetRef();
+		Entry->ParentMaterial = ParentMaterial;
+	}
+
+	if (IsValid(Material) && Entry->Instances.Num() < GRadialMenuMaterialPoolSize)
+	{
+		Material->ClearParameterValues();
+
+		Entry->Instances.Add(Material);
+		++PoolState.NumPooled;
+	}
+
+	PoolState.UpdateCounters();
+}
+
+UMaterialInstanceDynamic* FRadialMenuMaterialPool::AcquireShared(UMaterialInterface* ParentMaterial, FName ParameterName, float ParameterValue)
+{
+	using namespace RadialMenuMaterialPool;
+
+	if (ParentMaterial == nullptr)
+		return nullptr;
+
+	FState& PoolState = GetState();
+
+	FSharedMaterial* Entry = PoolState.Shared.FindByPredicate([ParentMaterial, ParameterName, ParameterValue](const FSharedMaterial& Shared)
+		{
+			return Shared.ParentMaterial == ParentMaterial && Shared.ParameterName == ParameterName && Shared.ParameterValue == ParameterValue && IsValid(Shared.Instance);
+		});
+
+	if (Entry == nullptr)
+	{
+		Entry = &PoolState.Shared.AddDefaulted_GetRef();
+		Entry->ParentMaterial = ParentMaterial;
+		Entry->ParameterName = ParameterName;
+		Entry->ParameterValue = ParameterValue;
+		Entry->Instance = UMaterialInstanceDynamic::Create(ParentMaterial, GetTransientPackage());
+		Entry->Instance->SetScalarParameterValue(ParameterName, ParameterValue);
+	}
+
+	++Entry->NumUsers;
+	PoolState.UpdateCounters();
+
+	return Entry->Instance;
+}
+
+void FRadialMenuMaterialPool::ReleaseShared(UMaterialInstanceDynamic* Material)
+{
+	using namespace RadialMenuMaterialPool;
+
+	if (Material == nullptr || !State.IsValid())
+		return;
+
+	FState& PoolState = GetState();
+
+	const int32 EntryIndex = PoolState.Shared.IndexOfByPredicate([Material](const FSharedMaterial& Shared) { return Shared.Instance == Material; });
+	if (EntryIndex != INDEX_NONE && --PoolState.Shared[EntryIndex].NumUsers <= 0)
+	{
+		PoolState.Shared.RemoveAtSwap(EntryIndex);
+	}
+
+	PoolState.UpdateCounters();
+}
+
+int32 FRadialMenuMaterialPool::GetNumLive()
+{
+	return RadialMenuMaterialPool::GetState().NumLive;
+}
+
+int32 FRadialMenuMaterialPool::GetNumPooled()
+{
+	return RadialMenuMaterialPool::GetState().NumPooled;
+}
+
+int32 FRadialMenuMaterialPool::GetNumShared()
+{
+	return RadialMenuMaterialPool::GetState().Shared.Num();
+}
+
+void FRadialMenuMaterialPool::Trim()
+{
+	using namespace RadialMenuMaterialPool;
+
+	FState& PoolState = GetState();
+	PoolState.Pooled.Reset();
+	PoolState.NumPooled = 0;
+	PoolState.UpdateCounters();
+}
+
+void FRadialMenuMaterialPool::Shutdown()
+{
+	RadialMenuMaterialPool::State.Reset();
+}
+
+void FRadialMenuMaterialPool::DumpStats()
+{
+	using namespace RadialMenuMaterialPool;
+
+	const FState& PoolState = GetState();
+
+	UE_LOG(LogSlate, Display, TEXT("RadialMenu materials: %d live, %d pooled over %d parents, %d shared"),
+		PoolState.NumLive, PoolState.NumPooled, PoolState.Pooled.Num(), PoolState.Shared.Num());
+
+	for (const FSharedMaterial& Entry : PoolState.Shared)
+	{
+		UE_LOG(LogSlate, Display, TEXT("  shared %s, %s = %g, %d users"), *GetNameSafe(Entry.ParentMaterial), *Entry.ParameterName.ToString(), Entry.ParameterValue, Entry.NumUsers);
+	}
+}
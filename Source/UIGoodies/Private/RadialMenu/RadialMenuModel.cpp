@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuModel.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+
+FRadialMenuModelSnapshotRef FRadialMenuModel::Build(TArray<FRadialMenuItem> SourceItems) const
+{
+	TArray<FRadialMenuItem> Items;
+
+	if (Filter)
+	{
+		TArray<bool> PassedFilter;
+		PassedFilter.SetNumZeroed(SourceItems.Num());
+
+		ParallelFor(SourceItems.Num(), [&](int32 ItemIndex)
+			{
+				PassedFilter[ItemIndex] = Filter(SourceItems[ItemIndex]);
+			});
+
+		Items.Reserve(SourceItems.Num());
+		for (int32 ItemIndex = 0; ItemIndex < SourceItems.Num(); ++ItemIndex)
+		{
+			if (PassedFilter[ItemIndex])
+			{
+				Items.Add(MoveTemp(SourceItems[ItemIndex]));
+			}
+		}
+	}
+	else
+	{
+		Items = MoveTemp(SourceItems);
+	}
+
+	if (Weight)
+	{
+		ParallelFor(Items.Num(), [&](int32 ItemIndex)
+			{
+				Items[ItemIndex].Weight = FMath::Max(0.f, Weight(Items[ItemIndex]));
+			});
+	}
+
+	if (SortPredicate)
+	{
+		Items.StableSort([this](const FRadialMenuItem& A, const FRadialMenuItem& B)
+			{
+				return SortPredicate(A, B);
+			});
+	}
+
+	TArray<float> Weights;
+	Weights.SetNumUninitialized(Items.Num());
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		Weights[ItemIndex] = Items[ItemIndex].Weight;
+	}
+
+	TSharedRef<FRadialMenuSectorTable, ESPMode::ThreadSafe> SectorTable = MakeShared<FRadialMenuSectorTable, ESPMode::ThreadSafe>();
+	SectorTable->Build(Weights, StartingAngle);
+
+	return MakeShared<FRadialMenuModelSnapshot, ESPMode::ThreadSafe>(MoveTemp(Items), SectorTable);
+}
+
+void FRadialMenuModel::BuildAsync(TArray<FRadialMenuItem> SourceItems, FOnModelBuilt OnBuilt) const
+{
+	Async(EAsyncExecution::TaskGraph, [Model = *this, SourceItems = MoveTemp(SourceItems), OnBuilt = MoveTemp(OnBuilt)]() mutable
+		{
+			FRadialMenuModelSnapshotRef Snapshot = Model.Build(MoveTemp(SourceItems));
+
+			AsyncTask(ENamedThreads::GameThread, [Snapshot, OnBuilt = MoveTemp(OnBuilt)]()
+				{
+					OnBuilt(Snapshot);
+				});
+		});
+}
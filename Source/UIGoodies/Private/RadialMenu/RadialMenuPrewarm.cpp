@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuPrewarm.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "Fonts/FontCache.h"
+#include "Styling/SlateBrush.h"
+
+FString FRadialMenuPrewarmReport::ToString() const
+{
+	return FString::Printf(TEXT("%d labels, %d glyphs in %.2f ms, %d icons (%d failed) loaded in %.2f ms, %d brushes in %.2f ms"),
+		NumLabels, NumGlyphs, GlyphMs, NumIcons, NumFailedIcons, IconLoadMs, NumResolvedBrushes, BrushMs);
+}
+
+int32 FRadialMenuPrewarm::CacheGlyphs(const FString& Text, const FSlateFontInfo& Font, float FontScale)
+{
+	if (Text.IsEmpty() || !Font.HasValidFont() || !FSlateApplication::IsInitialized())
+		return 0;
+
+	const TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+
+	// Same shaping as the text blocks, so the atlas entries are the ones looked up when painting
+	const FShapedGlyphSequenceRef Sequence = FontCache->ShapeBidirectionalText(Text, Font, FontScale, TextBiDi::ETextDirection::LeftToRight, GetDefaultTextShapingMethod());
+
+	int32 NumGlyphs = 0;
+
+	for (const FShapedGlyphEntry& Glyph : Sequence->GetGlyphsToRender())
+	{
+		if (!Glyph.bIsVisible)
+			continue;
+
+		FontCache->GetShapedGlyphFontAtlasData(Glyph, Font.OutlineSettings);
+		++NumGlyphs;
+	}
+
+	return NumGlyphs;
+}
+
+bool FRadialMenuPrewarm::ResolveBrush(const FSlateBrush& Brush)
+{
+	if (Brush.DrawAs == ESlateBrushDrawType::NoDrawType || !FSlateApplication::IsInitialized())
+		return false;
+
+	if (Brush.GetResourceObject() == nullptr && Brush.GetResourceName().IsNone())
+		return false;
+
+	// The renderer keeps the resource of an object or a name, later brushes using it find it there
+	return FSlateApplication::Get().GetRenderer()->GetResourceHandle(Brush).IsValid();
+}
@@ -0,0 +1,115 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/RadialMenuSearchIndex.h"
+#include "Algo/BinarySearch.h"
+
+void FRadialMenuSearchIndex::Build(TArrayView<const FRadialMenuItem> Items)
+{
+	Reset();
+
+	ItemTexts.Reserve(Items.Num());
+
+	TArray<FString> Words;
+
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		const FRadialMenuItem& Item = Items[ItemIndex];
+
+		Words.Reset();
+		Item.Label.ToString().ToLower().ParseIntoArrayWS(Words);
+
+		for (const FName& Tag : Item.Tags)
+		{
+			Words.Add(Tag.ToString().ToLower());
+		}
+
+		ItemTexts.Add(FString::Join(Words, TEXT(" ")));
+
+		for (FString& Word : Words)
+		{
+			for (int32 CharIndex = 0; CharIndex + 3 <= Word.Len(); ++CharIndex)
+			{
+				TArray<int32>& Postings = TrigramItems.FindOrAdd(MakeTrigram(*Word + CharIndex));
+				if (Postings.Num() == 0 || Postings.Last() != ItemIndex)
+				{
+					Postings.Add(ItemIndex);
+				}
+			}
+
+			SortedTokens.Add({ MoveTemp(Word), ItemIndex });
+		}
+	}
+
+	SortedTokens.Sort([](const FToken& A, const FToken& B)
+		{
+			return A.Word < B.Word;
+		});
+}
+
+void FRadialMenuSearchIndex::Reset()
+{
+	ItemTexts.Reset();
+	SortedTokens.Reset();
+	TrigramItems.Reset();
+}
+
+void FRadialMenuSearchIndex::Search(const FString& Query, TBitArray<>& OutMatches) const
+{
+	TArray<FString> Terms;
+	Query.ToLower().ParseIntoArrayWS(Terms);
+
+	OutMatches.Init(true, ItemTexts.Num());
+
+	TBitArray<> TermMatches;
+	for (const FString& Term : Terms)
+	{
+		TermMatches.Init(false, ItemTexts.Num());
+		SearchTerm(Term, TermMatches);
+
+		OutMatches.CombineWithBitwiseAND(TermMatches, EBitwiseOperatorFlags::MaintainSize);
+	}
+}
+
+void FRadialMenuSearchIndex::SearchTerm(const FString& Term, TBitArray<>& OutMatches) const
+{
+	if (Term.Len() < 3)
+	{
+		// Too short for trigrams, match the beginning of the words
+		int32 TokenIndex = Algo::LowerBoundBy(SortedTokens, Term, [](const FToken& Token) -> const FString& { return Token.Word; });
+
+		for (; TokenIndex < SortedTokens.Num() && SortedTokens[TokenIndex].Word.StartsWith(Term); ++TokenIndex)
+		{
+			OutMatches[SortedTokens[TokenIndex].ItemIndex] = true;
+		}
+		return;
+	}
+
+	// Candidates come from the rarest trigram of the term, then are checked against the full text
+	const TArray<int32>* Candidates = nullptr;
+
+	for (int32 CharIndex = 0; CharIndex + 3 <= Term.Len(); ++CharIndex)
+	{
+		const TArray<int32>* Postings = TrigramItems.Find(MakeTrigram(*Term + CharIndex));
+		if (Postings == nullptr)
+			return;
+
+		if (Candidates == nullptr || Postings->Num() < Candidates->Num())
+		{
+			Candidates = Postings;
+		}
+	}
+
+	for (int32 ItemIndex : *Candidates)
+	{
+		if (ItemTexts[ItemIndex].Contains(Term, ESearchCase::CaseSensitive))
+		{
+			OutMatches[ItemIndex] = true;
+		}
+	}
+}
+
+uint32 FRadialMenuSearchIndex::MakeTrigram(const TCHAR* Chars)
+{
+	return HashCombine(HashCombine(GetTypeHash(Chars[0]), GetTypeHash(Chars[1])), GetTypeHash(Chars[2]));
+}
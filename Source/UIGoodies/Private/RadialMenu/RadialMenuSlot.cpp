@@ -24,7 +24,7 @@ void URadialMenuSlot::BuildSlot(TSharedRef<SRadialMenu> RadialMenu)
             Content == nullptr ? SNullWidget::NullWidget : Content->TakeWidget()
         ];
 
-    RadialMenu->OnSlotAdded(RadialMenu->GetChildren()->Num() - 1);
+    RadialMenu->OnSlotAdded(RadialMenu->GetAllChildren()->Num() - 1);
 }
 
 void URadialMenuSlot::ReleaseSlateResources(bool bReleaseChildren)
@@ -55,3 +55,27 @@ float URadialMenuSlot::GetWeight()
 {
     return Slot ? Slot->GetWeight() : Weight;
 }
+
+void URadialMenuSlot::SetContent(UWidget* InContent)
+{
+    check(Content == nullptr && InContent);
+
+    Content = InContent;
+    Content->Slot = this;
+
+    if (Slot)
+    {
+        Slot->AttachWidget(Content->TakeWidget());
+    }
+}
+
+void URadialMenuSlot::SetItem(const FRadialMenuItem& InItem)
+{
+    Item = InItem;
+    SetWeight(Item.Weight);
+
+    if (Content && Content->Implements<URadialMenuEntry>())
+    {
+        IRadialMenuEntry::Execute_OnRadialMenuItemSet(Content, Item);
+    }
+}
@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RadialMenu/SRadialLayoutBox.h"
+#include "RadialMenu/SRadialMenu.h"
+#include "Layout/ArrangedChildren.h"
+
+SLATE_IMPLEMENT_WIDGET(SRadialLayoutBox)
+void SRadialLayoutBox::PrivateRegisterAttributes(FSlateAttributeInitializer& AttributeInitializer)
+{
+}
+
+void SRadialLayoutBox::FSlot::Construct(const FChildren& SlotOwner, FSlotArguments&& InArgs)
+{
+	TSlotBase<FSlot>::Construct(SlotOwner, MoveTemp(InArgs));
+
+	if (InArgs._Weight.IsSet())
+	{
+		WeightParam = FMath::Max(InArgs._Weight.GetValue(), 0.f);
+	}
+}
+
+void SRadialLayoutBox::FSlot::NotifySlotChanged()
+{
+	if (SRadialLayoutBox* RadialLayoutBox = static_cast<SRadialLayoutBox*>(GetOwnerWidget()))
+	{
+		RadialLayoutBox->NotifySlotChanged();
+	}
+}
+
+SRadialLayoutBox::SRadialLayoutBox()
+	: Slots(this)
+{
+	SetCanTick(false);
+}
+
+void SRadialLayoutBox::Construct(const FArguments& InArgs)
+{
+	PreferredRadius = InArgs._PreferredRadius;
+	StartingAngle = InArgs._StartingAngle;
+
+	Slots.AddSlots(MoveTemp(const_cast<TArray<FSlot::FSlotArguments>&>(InArgs._Slots)));
+	NotifySlotChanged();
+}
+
+SRadialLayoutBox::FSlot::FSlotArguments SRadialLayoutBox::Slot()
+{
+	return FSlot::FSlotArguments(MakeUnique<FSlot>());
+}
+
+SRadialLayoutBox::FScopedWidgetSlotArguments SRadialLayoutBox::AddSlot()
+{
+	return FScopedWidgetSlotArguments{ MakeUnique<FSlot>(), Slots, INDEX_NONE, [this](const FSlot*, int32)
+		{
+			NotifySlotChanged();
+		} };
+}
+
+int32 SRadialLayoutBox::RemoveSlot(const TSharedRef<SWidget>& SlotWidget)
+{
+	for (int32 SlotIdx = 0; SlotIdx < Slots.Num(); ++SlotIdx)
+	{
+		if (SlotWidget == Slots[SlotIdx].GetWidget())
+		{
+			Slots.RemoveAt(SlotIdx);
+			NotifySlotChanged();
+			return SlotIdx;
+		}
+	}
+
+	return -1;
+}
+
+void SRadialLayoutBox::ClearChildren()
+{
+	Slots.Empty();
+	NotifySlotChanged();
+}
+
+void SRadialLayoutBox::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	// Arranged against the geometry passed in, so the layout is stable without a tick
+	const float Width = AllottedGeometry.GetLocalSize().X;
+	const float Radius = Width / 2.f * PreferredRadius;
+	const float MiddlePointOffset = Width / 2.f;
+
+	for (int32 ChildIndex = 0; ChildIndex < Slots.Num() && ChildIndex < SectorTable.Num(); ++ChildIndex)
+	{
+		const TSharedRef<SWidget>& Widget = Slots[ChildIndex].GetWidget();
+
+		if (!ArrangedChildren.Accepts(Widget->GetVisibility()))
+		{
+			continue;
+		}
+
+		const SRadialMenu::FChildArranger::FArrangementData ArrangementData =
+			SRadialMenu::FChildArranger::ArrangeSlot(SectorTable.GetDirection(ChildIndex), Radius, MiddlePointOffset, Widget->GetDesiredSize());
+
+		ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(Widget, ArrangementData.SlotOffset, ArrangementData.SlotSize));
+	}
+}
+
+FVector2D SRadialLayoutBox::ComputeDesiredSize(float) const
+{
+	FVector2D LargestDesiredSizeOfSlot = FVector2D::ZeroVector;
+	float SmallestAngleWidth = 360.f;
+
+	for (int32 ChildIndex = 0; ChildIndex < Slots.Num() && ChildIndex < SectorTable.Num(); ++ChildIndex)
+	{
+		const TSharedRef<SWidget>& Widget = Slots[ChildIndex].GetWidget();
+
+		if (Widget->GetVisibility() == EVisibility::Collapsed || SectorTable.GetAngleWidth(ChildIndex) <= 0.f)
+		{
+			continue;
+		}
+
+		LargestDesiredSizeOfSlot = FVector2D::Max(LargestDesiredSizeOfSlot, Widget->GetDesiredSize());
+		SmallestAngleWidth = FMath::Min(SmallestAngleWidth, SectorTable.GetAngleWidth(ChildIndex));
+	}
+
+	const float DesiredWidth = SRadialMenu::FChildArranger::ComputeDesiredWidth(SmallestAngleWidth, LargestDesiredSizeOfSlot, PreferredRadius);
+	return FVector2D(DesiredWidth, DesiredWidth);
+}
+
+FChildren* SRadialLayoutBox::GetChildren()
+{
+	return &Slots;
+}
+
+void SRadialLayoutBox::SetPreferredRadius(float InPreferredRadius)
+{
+	if (PreferredRadius != InPreferredRadius)
+	{
+		PreferredRadius = InPreferredRadius;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialLayoutBox::SetStartingAngle(float InStartingAngle)
+{
+	if (StartingAngle != InStartingAngle)
+	{
+		StartingAngle = InStartingAngle;
+		NotifySlotChanged();
+	}
+}
+
+void SRadialLayoutBox::NotifySlotChanged()
+{
+	TArray<float, TInlineAllocator<32>> Weights;
+	Weights.Reserve(Slots.Num());
+
+	for (int32 ChildIndex = 0; ChildIndex < Slots.Num(); ++ChildIndex)
+	{
+		Weights.Add(Slots[ChildIndex].GetWeight());
+	}
+
+	SectorTable.Build(Weights, StartingAngle);
+
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
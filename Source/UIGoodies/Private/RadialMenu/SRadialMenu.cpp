@@ -5,7 +5,33 @@
 #include "Layout/LayoutUtils.h"
 #include "InputCoreTypes.h"
 #include "Materials/MaterialInterface.h"
+#include "Framework/Application/SlateApplication.h"
 #include "Framework/Application/SlateUser.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/SlateRenderer.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "RadialMenu/RadialMenuLayoutKernel.h"
+#include "RadialMenu/RadialMenuLayoutCache.h"
+#include "CoreGlobals.h"
+#include "RadialMenu/RadialMenuMaterialPool.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "HAL/IConsoleManager.h"
+#include "Widgets/SNullWidget.h"
+
+static FAutoConsoleCommand DumpRadialMenuMemoryCommand(
+	TEXT("RadialMenu.DumpMemory"),
+	TEXT("Log the slots, widgets, sector tables, overlay caches and materials held by every radial menu"),
+	FConsoleCommandDelegate::CreateStatic(&SRadialMenu::DumpMemory));
+
+static bool GRadialMenuTrackLatency = false;
+static FAutoConsoleVariableRef CVarRadialMenuTrackLatency(
+	TEXT("RadialMenu.TrackLatency"),
+	GRadialMenuTrackLatency,
+	TEXT("Record the input to visible selection latency of every radial menu, see RadialMenu.DumpLatency"));
+
+#define RADIALMENU_MATERIAL_SELECTEDSECTORANGLE "SelectedSectorAngle"
+#define RADIALMENU_MATERIAL_SELECTORANGLE "SelectorAngle"
+#define RADIALMENU_MATERIAL_SECTORSAMOUNT "SectorsAmount"
 
 SLATE_IMPLEMENT_WIDGET(SRadialMenu)
 void SRadialMenu::PrivateRegisterAttributes(FSlateAttributeInitializer& AttributeInitializer)
@@ -22,46 +48,281 @@ void SRadialMenu::FSlot::Construct(const FChildren& SlotOwner, FSlotArguments&&
 	}
 }
 
+const SRadialMenu* SRadialMenu::FSlot::GetRadialMenu() const
+{
+	return static_cast<const SRadialMenu*>(GetOwnerWidget());
+}
+
+void SRadialMenu::FSlot::NotifySlotChanged(bool bSlotLayerChanged)
+{
+	if (SRadialMenu* RadialMenu = static_cast<SRadialMenu*>(GetOwnerWidget()))
+	{
+		RadialMenu->NotifySlotChanged(this, bSlotLayerChanged);
+	}
+}
+
+float SRadialMenu::FSlot::GetAngle() const
+{
+	const SRadialMenu* RadialMenu = GetRadialMenu();
+	return RadialMenu && RadialMenu->SectorTable->IsValidIndex(SectorIndex) ? RadialMenu->SectorTable->GetAngle(SectorIndex) : 0.f;
+}
+
+float SRadialMenu::FSlot::GetAngleWidth() const
+{
+	const SRadialMenu* RadialMenu = GetRadialMenu();
+	return RadialMenu && RadialMenu->SectorTable->IsValidIndex(SectorIndex) ? RadialMenu->SectorTable->GetAngleWidth(SectorIndex) : 0.f;
+}
+
+FVector2D SRadialMenu::FSlot::GetDirection() const
+{
+	const SRadialMenu* RadialMenu = GetRadialMenu();
+	return RadialMenu && RadialMenu->SectorTable->IsValidIndex(SectorIndex) ? RadialMenu->SectorTable->GetDirection(SectorIndex) : FVector2D::ZeroVector;
+}
+
 SRadialMenu::SRadialMenu()
 	: Slots(this)
 	,BorderImageAttribute(*this, FCoreStyle::Get().GetBrush("Border"))
+	,SectorTable(MakeShared<FRadialMenuSectorTable, ESPMode::ThreadSafe>())
 {
+	GetLiveMenus().Add(this);
 }
 
 void SRadialMenu::Construct(const FArguments& InArgs)
 {
-	TotalWeight = 0;
-
 	PreferredRadius = InArgs._PreferredRadius;
 	StartingAngle = InArgs._StartingAngle;
 	AnalogValueDeadzone = InArgs._AnalogValueDeadzone;
 	OnSelectionChanged = InArgs._OnSelectionChanged;
 	OnAngleChanged = InArgs._OnAngleChanged;
+	OnSlotClicked = InArgs._OnSlotClicked;
 	CursorSpeed = InArgs._CursorSpeed;
+	SetSelectionHysteresis(InArgs._SelectionHysteresis);
+	SetSectorMagnetism(InArgs._SectorMagnetism);
+	SetSelectionPrediction(InArgs._SelectionPrediction);
+	SetHitTestRadius(InArgs._HitTestInnerRadius, InArgs._HitTestOuterRadius);
+	bSelectOnClick = InArgs._SelectOnClick;
+	OverlayFont = InArgs._OverlayFont;
+	OverlayColor = InArgs._OverlayColor;
+	OverlayArcThickness = InArgs._OverlayArcThickness;
+	DisabledSlotTint = InArgs._DisabledSlotTint;
+	PlaceholderBrush = InArgs._PlaceholderBrush;
+	bInstanceBackgroundMaterial = InArgs._InstanceBackgroundMaterial;
+	bStaticBackground = InArgs._StaticBackground;
+
+	CurrentAngle = 0.f;
+	TargetAngle = 0.f;
+
+	SetLOD(InArgs._LOD);
+
+	bTrackLatency = InArgs._TrackLatency;
 
 	SetBorderImage(InArgs._BorderImage);
 
 	Slots.AddSlots(MoveTemp(const_cast<TArray<FSlot::FSlotArguments>&>(InArgs._Slots)));
+	UpdateSectors();
+
+	if (InArgs._EnableInput)
+	{
+		InitInputProcessor(InArgs._MouseAsAnalogCursor, InArgs._StickType);
+		SetAnalogStickEnabled(InArgs._AnalogStickEnabled);
+	}
 }
 
 void SRadialMenu::InitInputProcessor(bool UseMouseAsAnalogCursor, EAnalogStickType StickType)
 {
-	if (!FSlateApplication::IsInitialized())
-		return;
+	ReleaseInputProcessor();
 
 	InputProcessor = MakeShared<FRadialMenuInputProcessor>(SharedThis(this));
 	InputProcessor->SetMouseAsAnalogCursor(UseMouseAsAnalogCursor);
 	InputProcessor->SetAnalogStickType(StickType);
 
+	UpdateInputProcessorRegistration();
+}
+
+void SRadialMenu::ReleaseInputProcessor()
+{
+	UnregisterInputProcessor();
+
+	InputProcessor.Reset();
+}
+
+void SRadialMenu::UpdateInputProcessorRegistration()
+{
+	// Without the Slate application (e.g. headless replay) the input is fed directly to the processor
+	if (!InputProcessor.IsValid() || !FSlateApplication::IsInitialized())
+		return;
+
+	const bool bShouldBeRegistered = LOD == ERadialMenuLOD::Full;
+	if (bShouldBeRegistered == bInputProcessorRegistered)
+		return;
+
+	if (!bShouldBeRegistered)
+	{
+		UnregisterInputProcessor();
+		return;
+	}
+
 	FSlateApplication::Get().RegisterInputPreProcessor(InputProcessor);
+	ActivationStateChangedHandle = FSlateApplication::Get().OnApplicationActivationStateChanged().AddSP(this, &SRadialMenu::HandleApplicationActivationStateChanged);
+
+	bInputProcessorRegistered = true;
 }
 
-SRadialMenu::~SRadialMenu()
+void SRadialMenu::UnregisterInputProcessor()
 {
-	if (FSlateApplication::IsInitialized())
+	if (bInputProcessorRegistered && FSlateApplication::IsInitialized())
 	{
 		FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
+		FSlateApplication::Get().OnApplicationActivationStateChanged().Remove(ActivationStateChangedHandle);
+	}
+
+	ActivationStateChangedHandle.Reset();
+	bInputProcessorRegistered = false;
+
+	// The end of a touch in progress would not be received anymore
+	if (InputProcessor.IsValid())
+	{
+		InputProcessor->CancelTouch();
+	}
+}
+
+void SRadialMenu::HandleApplicationActivationStateChanged(const bool bIsActive)
+{
+	if (!bIsActive && InputProcessor.IsValid())
+	{
+		InputProcessor->CancelTouch();
+	}
+}
+
+void SRadialMenu::SetLOD(ERadialMenuLOD InLOD)
+{
+	if (LOD == InLOD)
+		return;
+
+	const bool bChildrenChanged = LOD == ERadialMenuLOD::Minimal || InLOD == ERadialMenuLOD::Minimal;
+
+	// The entries are not measured anymore, keep the size the menu had with them
+	if (InLOD == ERadialMenuLOD::Minimal)
+	{
+		MinimalLODDesiredSize = GetDesiredSize();
+	}
+
+	LOD = InLOD;
+
+	// Without the animation the cursor would stop half way
+	if (LOD != ERadialMenuLOD::Full)
+	{
+		CurrentAngle = TargetAngle;
+		AngularVelocity = 0.f;
+	}
+
+	SetCanTick(LOD != ERadialMenuLOD::Minimal);
+	UpdateInputProcessorRegistration();
+	Invalidate(bChildrenChanged ? EInvalidateWidgetReason::ChildOrder : EInvalidateWidgetReason::Paint);
+}
+
+void SRadialMenu::StartInputRecording()
+{
+	if (InputProcessor.IsValid())
+	{
+		InputProcessor->SetRecorder(MakeShared<FRadialMenuInputRecorder>(TickGeometry));
+	}
+}
+
+FRadialMenuInputRecording SRadialMenu::StopInputRecording()
+{
+	if (!InputProcessor.IsValid() || !InputProcessor->GetRecorder().IsValid())
+		return FRadialMenuInputRecording();
+
+	FRadialMenuInputRecording Recording = InputProcessor->GetRecorder()->GetRecording();
+	InputProcessor->SetRecorder(nullptr);
+
+	return Recording;
+}
+
+SRadialMenu::~SRadialMenu()
+{
+	ReleaseInputProcessor();
+	ReleaseBackgroundMaterial();
+
+	GetLiveMenus().RemoveSingleSwap(this);
+}
+
+TArray<const SRadialMenu*>& SRadialMenu::GetLiveMenus()
+{
+	static TArray<const SRadialMenu*> LiveMenus;
+	return LiveMenus;
+}
+
+SRadialMenu::FMemoryStats SRadialMenu::GetMemoryStats() const
+{
+	FMemoryStats Stats;
+
+	Stats.NumSlots = Slots.Num();
+	Stats.SlotBytes = Slots.Num() * (sizeof(FSlot) + sizeof(void*));
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].GetWidget() != SNullWidget::NullWidget)
+		{
+			++Stats.NumWidgets;
+		}
+	}
+
+	Stats.SectorTableBytes = SectorTable->GetAllocatedSize();
+	Stats.SectorTableUsers = SectorTable.GetSharedReferenceCount();
+
+	Stats.OverlayBytes = SlotOverlays.GetAllocatedSize() + SlotOverlayCaches.GetAllocatedSize() + SlotMask.GetAllocatedSize();
+	for (const FSlotOverlayCache& Cache : SlotOverlayCaches)
+	{
+		Stats.OverlayBytes += Cache.ArcPoints.GetAllocatedSize() + Cache.CountText.GetAllocatedSize();
+	}
+
+	Stats.LatencyStatsBytes = LatencyStats.IsValid() ? LatencyStats->GetAllocatedSize() : 0;
+
+	Stats.NumMaterials = BackgroundMaterial.IsValid() ? 1 : 0;
+	Stats.bSharedMaterial = bSharedBackgroundMaterial;
+
+	return Stats;
+}
+
+void SRadialMenu::DumpMemory()
+{
+	SIZE_T TotalBytes = 0;
+	int32 TotalSlots = 0;
+	int32 TotalWidgets = 0;
+
+	for (const SRadialMenu* RadialMenu : GetLiveMenus())
+	{
+		const FMemoryStats Stats = RadialMenu->GetMemoryStats();
+
+		UE_LOG(LogSlate, Display, TEXT("RadialMenu %s: %.1f KB, %d slots (%d widgets) %llu B, sectors %llu B shared by %d, overlays %llu B, latency %llu B, %d %s material"),
+			*RadialMenu->GetTag().ToString(),
+			Stats.GetTotalBytes() / 1024.0,
+			Stats.NumSlots,
+			Stats.NumWidgets,
+			static_cast<uint64>(Stats.SlotBytes),
+			static_cast<uint64>(Stats.SectorTableBytes),
+			Stats.SectorTableUsers,
+			static_cast<uint64>(Stats.OverlayBytes),
+			static_cast<uint64>(Stats.LatencyStatsBytes),
+			Stats.NumMaterials,
+			Stats.bSharedMaterial ? TEXT("shared") : TEXT("pooled"));
+
+		TotalBytes += Stats.GetTotalBytes();
+		TotalSlots += Stats.NumSlots;
+		TotalWidgets += Stats.NumWidgets;
 	}
+
+	UE_LOG(LogSlate, Display, TEXT("RadialMenu total: %d menus, %.1f KB, %d slots, %d widgets, %d layouts, materials %d live %d pooled %d shared"),
+		GetLiveMenus().Num(),
+		TotalBytes / 1024.0,
+		TotalSlots,
+		TotalWidgets,
+		FRadialMenuLayoutCache::GetNumLayouts(),
+		FRadialMenuMaterialPool::GetNumLive(),
+		FRadialMenuMaterialPool::GetNumPooled(),
+		FRadialMenuMaterialPool::GetNumShared());
 }
 
 SRadialMenu::FSlot::FSlotArguments SRadialMenu::Slot()
@@ -76,27 +337,51 @@ SRadialMenu::FScopedWidgetSlotArguments SRadialMenu::AddSlot()
 
 void SRadialMenu::OnSlotAdded(int32 Index)
 {
-	FSlot& NewSlot = Slots[Index];
-	TotalWeight += NewSlot.GetWeight();
+	UpdateSectors();
+}
+
+void SRadialMenu::UpdateSectors()
+{
+	if (BatchUpdateCount > 0)
+	{
+		bSectorsDirty = true;
+		return;
+	}
 
-	float DegreeOffset = StartingAngle;
+	bSectorsDirty = false;
+
+	TArray<float, TInlineAllocator<32>> Weights;
+	Weights.Reserve(Slots.Num());
 
 	for (int32 ChildIndex = 0; ChildIndex < Slots.Num(); ++ChildIndex)
 	{
-		FSlot& Slot = Slots[ChildIndex];
+		Weights.Add(IsSlotVisible(ChildIndex) ? Slots[ChildIndex].GetWeight() : 0.f);
+	}
 
-		Slot.SetAngle(DegreeOffset);
+	SectorTable = FRadialMenuLayoutCache::FindOrBuild(Weights, StartingAngle);
 
-		float SlotAngleSizeAlpha = (Slot.GetWeight() / TotalWeight);
-		Slot.SetAngleWidth(360 * SlotAngleSizeAlpha);
+	ApplySectorsToSlots();
+}
 
-		FVector2D Direction;
-		Direction.X = FMath::Cos(FMath::DegreesToRadians(-DegreeOffset));
-		Direction.Y = FMath::Sin(FMath::DegreesToRadians(-DegreeOffset));
+void SRadialMenu::ApplySectorsToSlots()
+{
+	for (int32 ChildIndex = 0; ChildIndex < Slots.Num(); ++ChildIndex)
+	{
+		Slots[ChildIndex].SectorIndex = ChildIndex;
+	}
 
-		Slot.SetDirection(Direction);
+	if (bSharedBackgroundMaterial && SharedBackgroundSectorsAmount != Slots.Num())
+	{
+		// Shared instances are never changed, move to the one of the new sector count
+		ReleaseBackgroundMaterial();
+		UpdateBackgroundMaterial();
+	}
+	else
+	{
+		SetBackgroundParameter(RADIALMENU_MATERIAL_SECTORSAMOUNT, Slots.Num());
 
-		DegreeOffset += Slot.GetAngleWidth();
+		// The selected slot may have moved, or the sectors before it changed width
+		SetBackgroundParameter(RADIALMENU_MATERIAL_SELECTEDSECTORANGLE, GetSlotAngle(SelectedSlot));
 	}
 }
 
@@ -107,9 +392,21 @@ int32 SRadialMenu::RemoveSlot(const TSharedRef<SWidget>& SlotWidget)
 		const FSlot& Slot = Slots[SlotIdx];
 		if (SlotWidget == Slot.GetWidget())
 		{
-			TotalWeight -= Slot.GetWeight();
+			RemoveSlotAt(SlotIdx);
+			return SlotIdx;
+		}
+	}
+
+	return -1;
+}
 
-			Slots.RemoveAt(SlotIdx);
+int32 SRadialMenu::RemoveSlot(const FSlot* InSlot)
+{
+	for (int32 SlotIdx = 0; SlotIdx < Slots.Num(); ++SlotIdx)
+	{
+		if (&Slots[SlotIdx] == InSlot)
+		{
+			RemoveSlotAt(SlotIdx);
 			return SlotIdx;
 		}
 	}
@@ -117,12 +414,46 @@ int32 SRadialMenu::RemoveSlot(const TSharedRef<SWidget>& SlotWidget)
 	return -1;
 }
 
+void SRadialMenu::RemoveSlotAt(int32 SlotIdx)
+{
+	Slots.RemoveAt(SlotIdx);
+
+	if (SlotOverlays.IsValidIndex(SlotIdx))
+	{
+		SlotOverlays.RemoveAt(SlotIdx);
+		SlotOverlayCaches.RemoveAt(SlotIdx);
+	}
+
+	if (SlotMask.IsValidIndex(SlotIdx))
+	{
+		SlotMask.RemoveAt(SlotIdx);
+	}
+
+	if (SelectedSlot == SlotIdx)
+	{
+		SelectedSlot = -1;
+	}
+	else if (SelectedSlot > SlotIdx)
+	{
+		--SelectedSlot;
+	}
+
+	UpdateSectors();
+}
+
 void SRadialMenu::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-	Width = AllottedGeometry.GetLocalSize().X;
+	TRACE_CPUPROFILER_EVENT_SCOPE(SRadialMenu::Tick);
+
+	TickGeometry = AllottedGeometry;
+	LastTickFrame = GFrameCounter;
 
-	if (!InputProcessor.IsValid())
+	if (!InputProcessor.IsValid() || LOD != ERadialMenuLOD::Full)
+	{
+		// Menus without input or below the full LOD are still selected from code
+		RecordFrameState();
 		return;
+	}
 
 	FVector2D AnalogValueTemp = FVector2D::Zero();
 
@@ -130,157 +461,679 @@ void SRadialMenu::Tick(const FGeometry& AllottedGeometry, const double InCurrent
 	{
 		AnalogValueTemp = InputProcessor->GetAnalogValue();
 	}
+	else if (InputProcessor->HasTouchInput())
+	{
+		// Not normalized, so the analog deadzone also works as the touch deadzone around the centre
+		AnalogValueTemp = GetPointerAnalogValue(AllottedGeometry, InputProcessor->GetTouchPosition());
+	}
 	else if (!InputProcessor->GetMouseAsAnalogCursor() && InputProcessor->HasMouseInput())
 	{
-		FVector2D LocalPosition = AllottedGeometry.AbsoluteToLocal(InputProcessor->GetMousePosition());
-		FVector2D CenterPosition = AllottedGeometry.GetLocalSize() / 2;
+		const FVector2D MousePosition = InputProcessor->GetMousePosition();
+
+		// Hover only moves the cursor while the pointer is over the sectors ring
+		if (HitTestSlot(AllottedGeometry, MousePosition) != INDEX_NONE)
+		{
+			FVector2D LocalPosition = AllottedGeometry.AbsoluteToLocal(MousePosition);
+			FVector2D CenterPosition = AllottedGeometry.GetLocalSize() / 2;
 
-		AnalogValueTemp = LocalPosition - CenterPosition;
-		AnalogValueTemp.Normalize();
+			AnalogValueTemp = LocalPosition - CenterPosition;
+			AnalogValueTemp.Normalize();
+		}
 	}
 
 	// Adjust analog values according to dead zone
-	const float AnalogValsSize = AnalogValueTemp.Size();
+	const RadialMenuCore::FVec2 ShapedAnalogValue = RadialMenuCore::ApplyDeadzone(RadialMenuCore::FVec2(AnalogValueTemp.X, AnalogValueTemp.Y), AnalogValueDeadzone);
 
-	if (AnalogValsSize > 0.0f)
+	if (ShapedAnalogValue.Size() >= 0.05f)
 	{
-		const float TargetSize = FMath::Max(AnalogValsSize - AnalogValueDeadzone, 0.0f) / (1.0f - AnalogValueDeadzone);
-		AnalogValueTemp /= AnalogValsSize;
-		AnalogValueTemp *= TargetSize;
+		TargetAngle = RadialMenuCore::VectorToAngle(ShapedAnalogValue);
 
-		if (AnalogValueTemp.Size() >= 0.05f)
+		// Pull the cursor towards the centre of the selected sector while it stays inside of it
+		if (SectorMagnetism > 0.f && Slots.IsValidIndex(SelectedSlot))
 		{
-			TargetAngle = FRotator::ClampAxis(FMath::RadiansToDegrees(FMath::Atan2(-AnalogValueTemp.Y, AnalogValueTemp.X)));
+			const FSlot& Slot = Slots[SelectedSlot];
+			TargetAngle = RadialMenuCore::ApplyMagnetism(TargetAngle, Slot.GetAngle(), Slot.GetAngleWidth(), SectorMagnetism);
 		}
 	}
 
-	if (!FMath::IsNearlyEqual(CurrentAngle, TargetAngle, 1))
+	const float AngleToTarget = RadialMenuCore::NormalizeAxis(TargetAngle - CurrentAngle);
+
+	if (FMath::Abs(AngleToTarget) > 1.f)
 	{
-		CurrentAngle = FMath::FInterpTo(CurrentAngle, CurrentAngle + FRotator::NormalizeAxis(TargetAngle - CurrentAngle), InDeltaTime, CursorSpeed);
-		OnAngleChanged.ExecuteIfBound(CurrentAngle);
+		const float PreviousAngle = CurrentAngle;
 
-		for (int32 ChildIndex = 0; ChildIndex < Slots.Num(); ++ChildIndex)
+		CurrentAngle = RadialMenuCore::InterpAngleTo(CurrentAngle, TargetAngle, InDeltaTime, CursorSpeed);
+		NotifyAngleChanged();
+
+		if (InDeltaTime > 0.f)
 		{
-			const FSlot& Slot = Slots[ChildIndex];
+			const float FrameVelocity = RadialMenuCore::NormalizeAxis(CurrentAngle - PreviousAngle) / InDeltaTime;
+			AngularVelocity = FMath::Lerp(AngularVelocity, FrameVelocity, 0.5f);
+		}
 
-			float AngleDifference = FRotator::NormalizeAxis(Slot.GetAngle() - FRotator::NormalizeAxis(CurrentAngle));
+		UpdateSelection();
+	}
+	else
+	{
+		AngularVelocity = 0.f;
+	}
 
-			if (FMath::Abs(AngleDifference) <= Slot.GetAngleWidth() * 0.5)
-			{
-				SetSelectedSlot(ChildIndex);
-				break;
-			}
-		}
+	RecordFrameState();
+}
+
+void SRadialMenu::RecordFrameState()
+{
+	FrameState.FrameNumber = GFrameCounter;
+	FrameState.SelectedSlot = SelectedSlot;
+	FrameState.Angle = CurrentAngle;
+	FrameState.TargetAngle = TargetAngle;
+	FrameState.AngularVelocity = AngularVelocity;
+	FrameState.bSettled = FMath::Abs(RadialMenuCore::NormalizeAxis(TargetAngle - CurrentAngle)) <= 1.f;
+}
+
+void SRadialMenu::UpdateSelection()
+{
+	const float SelectionAngle = RadialMenuCore::PredictSelectionAngle(CurrentAngle, TargetAngle, AngularVelocity, SelectionPrediction);
+
+	const int32 NewSelectedSlot = SectorTable->FindSectorWithHysteresis(SelectionAngle, SelectedSlot, SelectionHysteresis);
+	if (NewSelectedSlot != INDEX_NONE)
+	{
+		SetSelectedSlot(NewSelectedSlot);
+	}
+}
+
+int32 SRadialMenu::FindSlotAtAngle(float Angle) const
+{
+	return SectorTable->FindSector(Angle);
+}
+
+int32 SRadialMenu::HitTestSlot(const FGeometry& Geometry, FVector2D AbsolutePosition) const
+{
+	const FVector2D LocalSize = Geometry.GetLocalSize();
+	const float Radius = LocalSize.X / 2.f;
+
+	if (Radius <= 0.f)
+		return INDEX_NONE;
+
+	const FVector2D Offset = Geometry.AbsoluteToLocal(AbsolutePosition) - LocalSize / 2;
+	const float Distance = Offset.Size() / Radius;
+
+	if (Distance < HitTestInnerRadius || Distance > HitTestOuterRadius)
+		return INDEX_NONE;
+
+	return FindSlotAtAngle(RadialMenuCore::VectorToAngle(RadialMenuCore::FVec2(Offset.X, Offset.Y)));
+}
+
+bool SRadialMenu::HandleMouseButtonDown(const FPointerEvent& MouseEvent)
+{
+	if (!bSelectOnClick || MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+		return false;
+
+	// Not ticked last frame means the menu is hidden
+	if (GFrameCounter - LastTickFrame > 1)
+		return false;
+
+	const int32 ClickedSlot = HitTestSlot(TickGeometry, MouseEvent.GetScreenSpacePosition());
+	if (ClickedSlot == INDEX_NONE)
+		return false;
+
+	SelectSlot(ClickedSlot);
+	OnSlotClicked.ExecuteIfBound(ClickedSlot);
+
+	return true;
+}
+
+bool SRadialMenu::HandleTouchStarted(const FPointerEvent& TouchEvent)
+{
+	if (GFrameCounter - LastTickFrame > 1)
+		return false;
+
+	const FGeometry& Geometry = TickGeometry;
+	const FVector2D LocalSize = Geometry.GetLocalSize();
+	const FVector2D Offset = Geometry.AbsoluteToLocal(TouchEvent.GetScreenSpacePosition()) - LocalSize / 2;
+
+	// The drag may start from the centre, so only the outer radius limits the touch
+	return LocalSize.X > 0.f && Offset.Size() <= LocalSize.X / 2.f * HitTestOuterRadius;
+}
+
+void SRadialMenu::HandleTouchEnded(const FPointerEvent& TouchEvent)
+{
+	const FVector2D AnalogValue = GetPointerAnalogValue(TickGeometry, TouchEvent.GetScreenSpacePosition());
+
+	// Released inside the deadzone cancels the gesture
+	if (AnalogValue.Size() <= AnalogValueDeadzone)
+		return;
+
+	const int32 ReleasedSlot = FindSlotAtAngle(RadialMenuCore::VectorToAngle(RadialMenuCore::FVec2(AnalogValue.X, AnalogValue.Y)));
+	if (ReleasedSlot == INDEX_NONE)
+		return;
+
+	if (bSelectOnClick)
+	{
+		SelectSlot(ReleasedSlot);
 	}
+
+	OnSlotClicked.ExecuteIfBound(ReleasedSlot);
+}
+
+FVector2D SRadialMenu::GetPointerAnalogValue(const FGeometry& Geometry, FVector2D AbsolutePosition) const
+{
+	const FVector2D LocalSize = Geometry.GetLocalSize();
+	const float Radius = LocalSize.X / 2.f;
+
+	if (Radius <= 0.f)
+		return FVector2D::Zero();
+
+	const FVector2D AnalogValue = (Geometry.AbsoluteToLocal(AbsolutePosition) - LocalSize / 2) / Radius;
+
+	return AnalogValue.GetClampedToMaxSize(1.0);
 }
 
-SRadialMenu::FChildArranger::FChildArranger(const SRadialMenu& InRadialMenu, const FOnSlotArranged& InOnSlotArranged)
+SRadialMenu::FChildArranger::FChildArranger(const SRadialMenu& InRadialMenu, float InWidth, const FOnSlotArranged& InOnSlotArranged)
 	: RadialMenu(InRadialMenu)
+	, Width(InWidth)
 	, OnSlotArranged(InOnSlotArranged)
 {
-	OngoingArrangementDataMap.Reserve(RadialMenu.Slots.Num());
+	const int32 NumSlots = RadialMenu.Slots.Num();
+
+	SlotIndices.Reserve(NumSlots);
+	DirectionsX.Reserve(NumSlots);
+	DirectionsY.Reserve(NumSlots);
+	SizesX.Reserve(NumSlots);
+	SizesY.Reserve(NumSlots);
 }
 
 void SRadialMenu::FChildArranger::Arrange()
 {
 	const int32 NumItems = RadialMenu.Slots.Num();
-	const float Radius = RadialMenu.Width / 2.f * RadialMenu.PreferredRadius;
-
-	int32 TargetNumItems = FMath::Max(1, NumItems);
-	const float DegreeIncrements = 360.0f/ TargetNumItems;
+	const float Radius = Width / 2.f * RadialMenu.PreferredRadius;
 
 	//Offset to create the elements based on the middle of the widget as starting point
-	const float MiddlePointOffset = RadialMenu.Width / 2.f;
+	const float MiddlePointOffset = Width / 2.f;
+
+	// Directions come straight from the float SoA of the sector table
+	const RadialMenuCore::FSectorTable& Sectors = RadialMenu.SectorTable->GetCoreTable();
+	const float* SectorDirectionsX = Sectors.GetDirectionsX();
+	const float* SectorDirectionsY = Sectors.GetDirectionsY();
 
+	// Gather the arranged slots into SoA arrays so the offsets of all of them are computed in one batch
 	for (int32 ChildIndex = 0; ChildIndex < NumItems; ++ChildIndex)
 	{
 		const FSlot& Slot = RadialMenu.Slots[ChildIndex];
 		const TSharedRef<SWidget>& Widget = Slot.GetWidget();
 
-		// Skip collapsed widgets.
-		if (Widget->GetVisibility() == EVisibility::Collapsed)
+		// Skip collapsed widgets, slots hidden by the mask and slots without a sector yet.
+		if (Widget->GetVisibility() == EVisibility::Collapsed || !RadialMenu.IsSlotVisible(ChildIndex) || !Sectors.IsValidIndex(Slot.GetSectorIndex()))
 		{
 			continue;
 		}
 
-		float DegreeOffset = -Slot.GetAngle();
+		const FVector2D DesiredSize = Widget->GetDesiredSize();
 
-		FArrangementData& ArrangementData = OngoingArrangementDataMap.Add(ChildIndex, FArrangementData());
+		SlotIndices.Add(ChildIndex);
+		DirectionsX.Add(SectorDirectionsX[Slot.GetSectorIndex()]);
+		DirectionsY.Add(SectorDirectionsY[Slot.GetSectorIndex()]);
+		SizesX.Add(DesiredSize.X);
+		SizesY.Add(DesiredSize.Y);
+	}
+
+	const int32 NumArranged = SlotIndices.Num();
 
-		const FVector2D DesiredSizeOfSlot = Widget->GetDesiredSize();
+	OffsetsX.SetNumUninitialized(NumArranged);
+	OffsetsY.SetNumUninitialized(NumArranged);
 
-		float SmallestSide = FMath::Min(DesiredSizeOfSlot.X / 2.f, DesiredSizeOfSlot.Y / 2.f);
-		ArrangementData.SlotOffset.X = (Radius - SmallestSide) * Slot.GetDirection().X + MiddlePointOffset - DesiredSizeOfSlot.X / 2.f;
-		ArrangementData.SlotOffset.Y = (Radius - SmallestSide) * Slot.GetDirection().Y + MiddlePointOffset - DesiredSizeOfSlot.Y / 2.f;
-		ArrangementData.SlotSize.X = DesiredSizeOfSlot.X;
-		ArrangementData.SlotSize.Y = DesiredSizeOfSlot.Y;
+	RadialMenuLayoutKernel::PlaceSlots(DirectionsX.GetData(), DirectionsY.GetData(), SizesX.GetData(), SizesY.GetData(), Radius, MiddlePointOffset, OffsetsX.GetData(), OffsetsY.GetData(), NumArranged);
+
+	for (int32 Index = 0; Index < NumArranged; ++Index)
+	{
+		FArrangementData ArrangementData;
+		ArrangementData.SlotIndex = SlotIndices[Index];
+		ArrangementData.SlotOffset = FVector2D(OffsetsX[Index], OffsetsY[Index]);
+		ArrangementData.SlotSize = FVector2D(SizesX[Index], SizesY[Index]);
 
-		OnSlotArranged(Slot, ArrangementData);
+		OnSlotArranged(RadialMenu.Slots[ArrangementData.SlotIndex], ArrangementData);
 	}
 }
 
-void SRadialMenu::FChildArranger::Arrange(const SRadialMenu& RadialMenu, const FOnSlotArranged& OnSlotArranged)
+SRadialMenu::FChildArranger::FArrangementData SRadialMenu::FChildArranger::ArrangeSlot(const FVector2D& Direction, float Radius, float MiddlePointOffset, const FVector2D& DesiredSizeOfSlot)
 {
-	FChildArranger(RadialMenu, OnSlotArranged).Arrange();
-}
+	const RadialMenuCore::FSlotPlacement Placement = RadialMenuCore::PlaceSlot(
+		RadialMenuCore::FVec2(Direction.X, Direction.Y), Radius, MiddlePointOffset, RadialMenuCore::FVec2(DesiredSizeOfSlot.X, DesiredSizeOfSlot.Y));
 
-void SRadialMenu::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
-{
-	FChildArranger::Arrange(*this, [&](const FSlot& Slot, const FChildArranger::FArrangementData& ArrangementData)
-		{
-			ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(Slot.GetWidget(), ArrangementData.SlotOffset, ArrangementData.SlotSize));
-		});
+	FArrangementData ArrangementData;
+	ArrangementData.SlotIndex = INDEX_NONE;
+	ArrangementData.SlotOffset = FVector2D(Placement.Offset.X, Placement.Offset.Y);
+	ArrangementData.SlotSize = FVector2D(Placement.Size.X, Placement.Size.Y);
+
+	return ArrangementData;
 }
 
-void SRadialMenu::CacheDesiredSize(float LayoutScaleMultiplier)
+float SRadialMenu::FChildArranger::ComputeDesiredWidth(float SmallestAngleWidth, const FVector2D& LargestDesiredSizeOfSlot, float PreferredRadius)
 {
+	return RadialMenuCore::ComputeDesiredWidth(SmallestAngleWidth, RadialMenuCore::FVec2(LargestDesiredSizeOfSlot.X, LargestDesiredSizeOfSlot.Y), PreferredRadius);
 }
 
-void SRadialMenu::ClearChildren()
+void SRadialMenu::FChildArranger::Arrange(const SRadialMenu& RadialMenu, float Width, const FOnSlotArranged& OnSlotArranged)
 {
-	Slots.Empty();
+	FChildArranger(RadialMenu, Width, OnSlotArranged).Arrange();
 }
 
-FVector2D SRadialMenu::ComputeDesiredSize(float) const
+void SRadialMenu::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
-	FVector2D MyDesiredSize = FVector2D::ZeroVector;
+	if (LOD == ERadialMenuLOD::Minimal)
+		return;
 
-	FChildArranger::Arrange(*this, [&](const FSlot& Slot, const FChildArranger::FArrangementData& ArrangementData)
+	// Arranged against the geometry passed in, so the layout settles in the same pass as the size changes
+	FChildArranger::Arrange(*this, AllottedGeometry.GetLocalSize().X, [&](const FSlot& Slot, const FChildArranger::FArrangementData& ArrangementData)
 		{
-			// Increase desired size to the maximum X and Y positions of any child widget.
-			MyDesiredSize.X = FMath::Max(MyDesiredSize.X, ArrangementData.SlotOffset.X + ArrangementData.SlotSize.X);
-			MyDesiredSize.Y = FMath::Max(MyDesiredSize.Y, ArrangementData.SlotOffset.Y + ArrangementData.SlotSize.Y);
+			ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(Slot.GetWidget(), ArrangementData.SlotOffset, ArrangementData.SlotSize));
 		});
-
-	return MyDesiredSize;
 }
 
-FChildren* SRadialMenu::GetChildren()
+void SRadialMenu::ClearChildren()
 {
-	return &Slots;
+	Slots.Empty();
+	SelectedSlot = -1;
+
+	SlotOverlays.Reset();
+	SlotOverlayCaches.Reset();
+	SlotMask.Empty();
+
+	UpdateSectors();
 }
 
-void SRadialMenu::SetMouseAsAnalogCursor(bool InMouseAsAnalogCursor)
+void SRadialMenu::MoveSlot(int32 IndexToMove, int32 IndexToDestination)
 {
-	if (InputProcessor.IsValid())
+	if (!Slots.IsValidIndex(IndexToMove) || !Slots.IsValidIndex(IndexToDestination) || IndexToMove == IndexToDestination)
+		return;
+
+	Slots.Move(IndexToMove, IndexToDestination);
+
+	// Overlays and the mask may stop short of the slots. Pad them over the moved range so the entries in between shift with their slots
+	const int32 NumMovedRange = FMath::Max(IndexToMove, IndexToDestination) + 1;
+
+	if (SlotOverlays.Num() > 0)
 	{
-		InputProcessor->SetMouseAsAnalogCursor(InMouseAsAnalogCursor);
+		if (SlotOverlays.Num() < NumMovedRange)
+		{
+			SlotOverlays.SetNum(NumMovedRange);
+			SlotOverlayCaches.SetNum(NumMovedRange);
+		}
+
+		const FRadialMenuSlotOverlay MovedOverlay = SlotOverlays[IndexToMove];
+		SlotOverlays.RemoveAt(IndexToMove);
+		SlotOverlays.Insert(MovedOverlay, IndexToDestination);
+
+		FSlotOverlayCache MovedCache = MoveTemp(SlotOverlayCaches[IndexToMove]);
+		SlotOverlayCaches.RemoveAt(IndexToMove);
+		SlotOverlayCaches.Insert(MoveTemp(MovedCache), IndexToDestination);
 	}
-}
 
-float SRadialMenu::GetSlotAngle(int32 SlotIndex)
-{
-	if (Slots.IsValidIndex(SlotIndex))
+	if (SlotMask.Num() > 0)
 	{
-		return Slots[SlotIndex].GetAngle();
+		if (SlotMask.Num() < NumMovedRange)
+		{
+			SlotMask.Add(true, NumMovedRange - SlotMask.Num());
+		}
+
+		const bool bMovedVisible = SlotMask[IndexToMove];
+		SlotMask.RemoveAt(IndexToMove);
+		SlotMask.Insert(bMovedVisible, IndexToDestination);
 	}
 
-	return 0;
+	if (SelectedSlot == IndexToMove)
+	{
+		SelectedSlot = IndexToDestination;
+	}
+	else if (IndexToMove < SelectedSlot && SelectedSlot <= IndexToDestination)
+	{
+		--SelectedSlot;
+	}
+	else if (IndexToDestination <= SelectedSlot && SelectedSlot < IndexToMove)
+	{
+		++SelectedSlot;
+	}
+
+	UpdateSectors();
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+void SRadialMenu::BeginBatchUpdate()
+{
+	++BatchUpdateCount;
+}
+
+void SRadialMenu::EndBatchUpdate()
+{
+	if (BatchUpdateCount > 0 && --BatchUpdateCount == 0 && bSectorsDirty)
+	{
+		UpdateSectors();
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialMenu::SetSlotMask(const TBitArray<>& InSlotMask)
+{
+	// Filters push a mask on every keystroke, most of them hide the same slots
+	bool bChanged = false;
+	for (int32 ChildIndex = 0; ChildIndex < Slots.Num() && !bChanged; ++ChildIndex)
+	{
+		const bool bNewVisible = !InSlotMask.IsValidIndex(ChildIndex) || InSlotMask[ChildIndex];
+		bChanged = bNewVisible != IsSlotVisible(ChildIndex);
+	}
+
+	if (!bChanged)
+		return;
+
+	SlotMask = InSlotMask;
+
+	UpdateSectors();
+	Invalidate(EInvalidateWidgetReason::Layout);
+
+	if (!IsSlotVisible(SelectedSlot))
+	{
+		SetSelectedSlot(-1);
+	}
+}
+
+void SRadialMenu::ApplySectorTable(const FRadialMenuSectorTableRef& InSectorTable)
+{
+	if (InSectorTable->Num() != Slots.Num() || InSectorTable->GetStartingAngle() != StartingAngle)
+	{
+		UpdateSectors();
+		return;
+	}
+
+	SectorTable = InSectorTable;
+	bSectorsDirty = false;
+
+	ApplySectorsToSlots();
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+FVector2D SRadialMenu::ComputeDesiredSize(float) const
+{
+	if (LOD == ERadialMenuLOD::Minimal)
+		return MinimalLODDesiredSize;
+
+	// Only the radius and the children sizes matter, never the size allotted last frame
+	FVector2D LargestDesiredSizeOfSlot = FVector2D::ZeroVector;
+	float SmallestAngleWidth = 360.f;
+
+	for (int32 ChildIndex = 0; ChildIndex < Slots.Num(); ++ChildIndex)
+	{
+		const FSlot& Slot = Slots[ChildIndex];
+		const TSharedRef<SWidget>& Widget = Slot.GetWidget();
+
+		if (Widget->GetVisibility() == EVisibility::Collapsed || !IsSlotVisible(ChildIndex) || Slot.GetAngleWidth() <= 0.f)
+		{
+			continue;
+		}
+
+		LargestDesiredSizeOfSlot = FVector2D::Max(LargestDesiredSizeOfSlot, Widget->GetDesiredSize());
+		SmallestAngleWidth = FMath::Min(SmallestAngleWidth, Slot.GetAngleWidth());
+	}
+
+	const float DesiredWidth = FChildArranger::ComputeDesiredWidth(SmallestAngleWidth, LargestDesiredSizeOfSlot, PreferredRadius);
+	return FVector2D(DesiredWidth, DesiredWidth);
+}
+
+FChildren* SRadialMenu::GetChildren()
+{
+	if (LOD == ERadialMenuLOD::Minimal)
+		return &FNoChildren::NoChildrenInstance;
+
+	return &Slots;
+}
+
+FChildren* SRadialMenu::GetAllChildren()
+{
+	return &Slots;
+}
+
+void SRadialMenu::SetStartingAngle(float InStartingAngle)
+{
+	if (StartingAngle != InStartingAngle)
+	{
+		StartingAngle = InStartingAngle;
+		UpdateSectors();
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialMenu::SetPreferredRadius(float InPreferredRadius)
+{
+	if (PreferredRadius != InPreferredRadius)
+	{
+		PreferredRadius = InPreferredRadius;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SRadialMenu::SetHitTestRadius(float InInnerRadius, float InOuterRadius)
+{
+	// Only read by the input hit tests, nothing is cached or painted from it
+	HitTestInnerRadius = FMath::Clamp(InInnerRadius, 0.f, 1.f);
+	HitTestOuterRadius = FMath::Max(HitTestInnerRadius, InOuterRadius);
+}
+
+void SRadialMenu::SetMouseAsAnalogCursor(bool InMouseAsAnalogCursor)
+{
+	if (InputProcessor.IsValid())
+	{
+		InputProcessor->SetMouseAsAnalogCursor(InMouseAsAnalogCursor);
+	}
+}
+
+void SRadialMenu::SetAnalogStickEnabled(bool bInAnalogStickEnabled)
+{
+	if (InputProcessor.IsValid())
+	{
+		InputProcessor->SetAnalogStickEnabled(bInAnalogStickEnabled);
+	}
+}
+
+void SRadialMenu::SetAnalogValue(FVector2D InAnalogValue)
+{
+	if (InputProcessor.IsValid())
+	{
+		InputProcessor->ProcessAnalogValue(InAnalogValue);
+	}
+}
+
+float SRadialMenu::GetSlotAngle(int32 SlotIndex)
+{
+	if (Slots.IsValidIndex(SlotIndex))
+	{
+		return Slots[SlotIndex].GetAngle();
+	}
+
+	return 0;
+}
+
+void SRadialMenu::SetSlotOverlays(TArrayView<const FRadialMenuSlotOverlay> InSlotOverlays)
+{
+	bool bChanged = SlotOverlays.Num() != InSlotOverlays.Num();
+
+	SlotOverlays.SetNum(InSlotOverlays.Num());
+	SlotOverlayCaches.SetNum(InSlotOverlays.Num());
+
+	for (int32 SlotIndex = 0; SlotIndex < InSlotOverlays.Num(); ++SlotIndex)
+	{
+		if (SlotOverlays[SlotIndex] != InSlotOverlays[SlotIndex])
+		{
+			SlotOverlays[SlotIndex] = InSlotOverlays[SlotIndex];
+			SlotOverlayCaches[SlotIndex].bDirty = true;
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SRadialMenu::SetSlotOverlay(int32 SlotIndex, const FRadialMenuSlotOverlay& InSlotOverlay)
+{
+	if (SlotIndex < 0)
+		return;
+
+	if (!SlotOverlays.IsValidIndex(SlotIndex))
+	{
+		SlotOverlays.SetNum(SlotIndex + 1);
+		SlotOverlayCaches.SetNum(SlotIndex + 1);
+	}
+	else if (SlotOverlays[SlotIndex] == InSlotOverlay)
+	{
+		return;
+	}
+
+	SlotOverlays[SlotIndex] = InSlotOverlay;
+	SlotOverlayCaches[SlotIndex].bDirty = true;
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+FRadialMenuSlotOverlay SRadialMenu::GetSlotOverlay(int32 SlotIndex) const
+{
+	return SlotOverlays.IsValidIndex(SlotIndex) ? SlotOverlays[SlotIndex] : FRadialMenuSlotOverlay();
+}
+
+void SRadialMenu::SetOverlayStyle(const FSlateFontInfo& InOverlayFont, const FLinearColor& InOverlayColor, float InOverlayArcThickness, const FLinearColor& InDisabledSlotTint)
+{
+	const bool bFontChanged = OverlayFont != InOverlayFont;
+	const bool bArcChanged = OverlayArcThickness != InOverlayArcThickness;
+
+	if (!bFontChanged && !bArcChanged && OverlayColor == InOverlayColor && DisabledSlotTint == InDisabledSlotTint)
+		return;
+
+	OverlayFont = InOverlayFont;
+	OverlayColor = InOverlayColor;
+	OverlayArcThickness = InOverlayArcThickness;
+	DisabledSlotTint = InDisabledSlotTint;
+
+	if (bFontChanged || bArcChanged)
+	{
+		for (FSlotOverlayCache& Cache : SlotOverlayCaches)
+		{
+			Cache.bDirty = true;
+		}
+	}
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SRadialMenu::SetPlaceholderBrush(const FSlateBrush* InPlaceholderBrush)
+{
+	if (PlaceholderBrush != InPlaceholderBrush)
+	{
+		PlaceholderBrush = InPlaceholderBrush;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
 }
 
 void SRadialMenu::SetBorderImage(TAttribute<const FSlateBrush*> InBorderImage)
 {
 	BorderImageAttribute.Assign(*this, InBorderImage);
+	UpdateBackgroundMaterial();
+}
+
+void SRadialMenu::SetStaticBackground(bool bInStaticBackground)
+{
+	if (bStaticBackground != bInStaticBackground)
+	{
+		bStaticBackground = bInStaticBackground;
+		UpdateBackgroundMaterial();
+	}
+}
+
+const FSlateBrush* SRadialMenu::GetBackgroundBrush() const
+{
+	return BackgroundMaterial.IsValid() ? &BackgroundBrush : BorderImageAttribute.Get();
+}
+
+void SRadialMenu::UpdateBackgroundMaterial()
+{
+	// The image is read once, a bound brush attribute switching materials is not followed
+	const FSlateBrush* SourceBrush = BorderImageAttribute.Get();
+
+	UMaterialInterface* ParentMaterial = bInstanceBackgroundMaterial && SourceBrush ? Cast<UMaterialInterface>(SourceBrush->GetResourceObject()) : nullptr;
+
+	// Instances given to the brush are drawn as they are
+	if (ParentMaterial && ParentMaterial->IsA<UMaterialInstanceDynamic>())
+	{
+		ParentMaterial = nullptr;
+	}
+
+	if (ParentMaterial != BackgroundParentMaterial.Get() || bStaticBackground != bSharedBackgroundMaterial)
+	{
+		ReleaseBackgroundMaterial();
+
+		if (ParentMaterial)
+		{
+			AcquireBackgroundMaterial(ParentMaterial);
+		}
+	}
+
+	if (BackgroundMaterial.IsValid())
+	{
+		BackgroundBrush = *SourceBrush;
+		BackgroundBrush.SetResourceObject(BackgroundMaterial.Get());
+	}
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SRadialMenu::AcquireBackgroundMaterial(UMaterialInterface* ParentMaterial)
+{
+	BackgroundParentMaterial = ParentMaterial;
+	bSharedBackgroundMaterial = bStaticBackground;
+
+	if (bSharedBackgroundMaterial)
+	{
+		BackgroundMaterial.Reset(FRadialMenuMaterialPool::AcquireShared(ParentMaterial, RADIALMENU_MATERIAL_SECTORSAMOUNT, Slots.Num()));
+		SharedBackgroundSectorsAmount = Slots.Num();
+		return;
+	}
+
+	BackgroundMaterial.Reset(FRadialMenuMaterialPool::Acquire(ParentMaterial));
+	BackgroundMaterial->SetScalarParameterValue(RADIALMENU_MATERIAL_SECTORSAMOUNT, Slots.Num());
+	BackgroundMaterial->SetScalarParameterValue(RADIALMENU_MATERIAL_SELECTORANGLE, CurrentAngle);
+	BackgroundMaterial->SetScalarParameterValue(RADIALMENU_MATERIAL_SELECTEDSECTORANGLE, GetSlotAngle(SelectedSlot));
+}
+
+void SRadialMenu::ReleaseBackgroundMaterial()
+{
+	if (BackgroundMaterial.IsValid())
+	{
+		if (bSharedBackgroundMaterial)
+		{
+			FRadialMenuMaterialPool::ReleaseShared(BackgroundMaterial.Get());
+		}
+		else
+		{
+			FRadialMenuMaterialPool::Release(BackgroundMaterial.Get());
+		}
+	}
+
+	BackgroundMaterial.Reset();
+	BackgroundParentMaterial.Reset();
+	bSharedBackgroundMaterial = false;
+}
+
+void SRadialMenu::SetBackgroundParameter(FName ParameterName, float Value)
+{
+	if (BackgroundMaterial.IsValid() && !bSharedBackgroundMaterial)
+	{
+		BackgroundMaterial->SetScalarParameterValue(ParameterName, Value);
+	}
+}
+
+void SRadialMenu::NotifyAngleChanged()
+{
+	OnAngleChanged.ExecuteIfBound(CurrentAngle);
+	SetBackgroundParameter(RADIALMENU_MATERIAL_SELECTORANGLE, CurrentAngle);
 }
 
 void SRadialMenu::SelectSlot(int32 SlotIndex)
@@ -292,33 +1145,132 @@ void SRadialMenu::SelectSlot(int32 SlotIndex)
 
 	CurrentAngle = Slot.GetAngle();
 	TargetAngle = CurrentAngle;
-	OnAngleChanged.ExecuteIfBound(CurrentAngle);
+	NotifyAngleChanged();
 
 	SetSelectedSlot(SlotIndex);
 }
 
+bool SRadialMenu::IsTrackingLatency() const
+{
+	return bTrackLatency || GRadialMenuTrackLatency;
+}
+
 void SRadialMenu::SetSelectedSlot(int32 SlotIndex)
 {
 	if (SelectedSlot != SlotIndex)
 	{
+		const bool bRecordLatency = IsTrackingLatency();
+
+		FRadialMenuLatencySample LatencySample;
+		if (bRecordLatency)
+		{
+			LatencySample.SelectionTime = FPlatformTime::Seconds();
+			LatencySample.SelectionFrame = GFrameCounter;
+
+			// Programmatic selections have no input event, they start at the selection itself
+			const bool bFromInput = InputProcessor.IsValid() && InputProcessor->GetLastInputFrame() + 1 >= GFrameCounter;
+			LatencySample.InputTime = bFromInput ? InputProcessor->GetLastInputTime() : LatencySample.SelectionTime;
+			LatencySample.InputFrame = bFromInput ? InputProcessor->GetLastInputFrame() : LatencySample.SelectionFrame;
+		}
+
 		SelectedSlot = SlotIndex;
 		OnSelectionChanged.ExecuteIfBound(SelectedSlot);
+		SetBackgroundParameter(RADIALMENU_MATERIAL_SELECTEDSECTORANGLE, GetSlotAngle(SelectedSlot));
 
-		FSlateApplication::Get().ForEachUser([&](FSlateUser& User) {
-			if (FSlateApplication::Get().SetUserFocus(User.GetUserIndex(), Slots[SelectedSlot].GetWidget(), EFocusCause::SetDirectly))
+		if (bRecordLatency)
+		{
+			if (!LatencyStats.IsValid())
 			{
+				LatencyStats = MakeUnique<FRadialMenuLatencyStats>(GetTag().IsNone() ? FName(TEXT("SRadialMenu")) : GetTag());
 			}
+
+			LatencySample.BroadcastTime = FPlatformTime::Seconds();
+			PendingLatencySample = LatencySample;
+
+			// Under an invalidation panel the sample would otherwise wait for an unrelated repaint
+			Invalidate(EInvalidateWidgetReason::Paint);
+		}
+
+		// Headless replays run without the Slate application
+		if (!Slots.IsValidIndex(SelectedSlot) || !FSlateApplication::IsInitialized())
+			return;
+
+		FSlateApplication::Get().ForEachUser([this](FSlateUser& User)
+			{
+				FSlateApplication::Get().SetUserFocus(User.GetUserIndex(), Slots[SelectedSlot].GetWidget(), EFocusCause::SetDirectly);
 			});
 	}
 }
 
+int32 SRadialMenu::SelectNeighbourSlot(bool bClockwise)
+{
+	SelectSlot(SectorTable->GetNeighbour(SelectedSlot, bClockwise));
+	return SelectedSlot;
+}
+
+int32 SRadialMenu::SelectSlotInDirection(ERadialMenuDirection Direction)
+{
+	SelectSlot(SectorTable->GetSectorInDirection(Direction));
+	return SelectedSlot;
+}
+
+FNavigationReply SRadialMenu::OnNavigation(const FGeometry& MyGeometry, const FNavigationEvent& InNavigationEvent)
+{
+	int32 NewSelectedSlot = INDEX_NONE;
+
+	switch (InNavigationEvent.GetNavigationType())
+	{
+	case EUINavigation::Up:
+		NewSelectedSlot = SelectSlotInDirection(ERadialMenuDirection::North);
+		break;
+	case EUINavigation::Down:
+		NewSelectedSlot = SelectSlotInDirection(ERadialMenuDirection::South);
+		break;
+	case EUINavigation::Left:
+		NewSelectedSlot = SelectSlotInDirection(ERadialMenuDirection::West);
+		break;
+	case EUINavigation::Right:
+		NewSelectedSlot = SelectSlotInDirection(ERadialMenuDirection::East);
+		break;
+	case EUINavigation::Next:
+		NewSelectedSlot = SelectNeighbourSlot(true);
+		break;
+	case EUINavigation::Previous:
+		NewSelectedSlot = SelectNeighbourSlot(false);
+		break;
+	default:
+		break;
+	}
+
+	// The selection already moved the focus, so skip the geometric search of the children
+	if (NewSelectedSlot != INDEX_NONE)
+	{
+		return FNavigationReply::Stop();
+	}
+
+	return SPanel::OnNavigation(MyGeometry, InNavigationEvent);
+}
+
 void SRadialMenu::NotifySlotChanged(const FSlot* InSlot, bool bSlotLayerChanged)
 {
+	UpdateSectors();
+	Invalidate(EInvalidateWidgetReason::Layout);
 }
 
 int32 SRadialMenu::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
-	const FSlateBrush* BrushResource = BorderImageAttribute.Get();
+	TRACE_CPUPROFILER_EVENT_SCOPE(SRadialMenu::OnPaint);
+
+	if (PendingLatencySample.IsSet() && LatencyStats.IsValid())
+	{
+		PendingLatencySample->VisibleTime = FPlatformTime::Seconds();
+		PendingLatencySample->VisibleFrame = GFrameCounter;
+
+		LatencyStats->AddSample(PendingLatencySample.GetValue());
+		PendingLatencySample.Reset();
+	}
+
+	const FSlateBrush* BrushResource = GetBackgroundBrush();
 
 	const bool bEnabled = ShouldBeEnabled(bParentEnabled);
 
@@ -335,7 +1287,161 @@ int32 SRadialMenu::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeom
 		);
 	}
 
-	return SPanel::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bEnabled);
+	if (LOD == ERadialMenuLOD::Minimal)
+		return LayerId;
+
+	// Children are painted here instead of SPanel::OnPaint so that the slot overlays can tint them and draw on top
+	const FPaintArgs NewArgs = Args.WithNewParent(this);
+	int32 MaxLayerId = LayerId;
+
+	// Every child starts on the same layer, like SPanel::PaintArrangedChildren, so their elements can be batched.
+	// The overlays are drawn afterwards on one layer above all of them
+	const int32 ChildLayerId = LayerId + 1;
+
+	struct FOverlayToPaint
+	{
+		int32 SlotIndex;
+		FGeometry Geometry;
+	};
+	TArray<FOverlayToPaint, TInlineAllocator<16>> OverlaysToPaint;
+
+	const bool bPaintPlaceholders = PlaceholderBrush && PlaceholderBrush->DrawAs != ESlateBrushDrawType::NoDrawType;
+	const float Width = AllottedGeometry.GetLocalSize().X;
+	const float Radius = Width / 2.f * PreferredRadius;
+
+	FChildArranger::Arrange(*this, Width, [&](const FSlot& Slot, const FChildArranger::FArrangementData& ArrangementData)
+		{
+			// Slot waiting for its content, e.g. in a progressively populated menu
+			if (Slot.GetWidget() == SNullWidget::NullWidget)
+			{
+				if (bPaintPlaceholders)
+				{
+					const FChildArranger::FArrangementData PlaceholderData = FChildArranger::ArrangeSlot(Slot.GetDirection(), Radius, Width / 2.f, PlaceholderBrush->ImageSize);
+
+					FSlateDrawElement::MakeBox(
+						OutDrawElements,
+						LayerId + 1,
+						AllottedGeometry.ToPaintGeometry(PlaceholderData.SlotSize, FSlateLayoutTransform(PlaceholderData.SlotOffset)),
+						PlaceholderBrush,
+						ESlateDrawEffect::None,
+						PlaceholderBrush->GetTint(InWidgetStyle) * InWidgetStyle.GetColorAndOpacityTint());
+
+					MaxLayerId = FMath::Max(MaxLayerId, LayerId + 1);
+				}
+				return;
+			}
+
+			const FArrangedWidget ArrangedWidget(Slot.GetWidget(), AllottedGeometry.MakeChild(ArrangementData.SlotSize, FSlateLayoutTransform(ArrangementData.SlotOffset)));
+
+			if (!ArrangedWidget.Widget->GetVisibility().IsVisible() || IsChildWidgetCulled(MyCullingRect, ArrangedWidget))
+			{
+				return;
+			}
+
+			const bool bSlotEnabled = !SlotOverlays.IsValidIndex(ArrangementData.SlotIndex) || SlotOverlays[ArrangementData.SlotIndex].bEnabled;
+
+			FWidgetStyle SlotWidgetStyle = InWidgetStyle;
+			if (!bSlotEnabled)
+			{
+				SlotWidgetStyle.BlendColorAndOpacityTint(DisabledSlotTint);
+			}
+
+			const int32 SlotLayerId = ArrangedWidget.Widget->Paint(NewArgs, ArrangedWidget.Geometry, MyCullingRect, OutDrawElements, ChildLayerId, SlotWidgetStyle, bEnabled && bSlotEnabled);
+
+			if (LOD == ERadialMenuLOD::Full && SlotOverlays.IsValidIndex(ArrangementData.SlotIndex))
+			{
+				OverlaysToPaint.Add({ ArrangementData.SlotIndex, ArrangedWidget.Geometry });
+			}
+
+			MaxLayerId = FMath::Max(MaxLayerId, SlotLayerId);
+		});
+
+	if (OverlaysToPaint.Num() > 0)
+	{
+		const int32 OverlayLayerId = MaxLayerId + 1;
+
+		for (const FOverlayToPaint& Overlay : OverlaysToPaint)
+		{
+			PaintSlotOverlay(Overlay.SlotIndex, Overlay.Geometry, OutDrawElements, OverlayLayerId, InWidgetStyle);
+		}
+
+		MaxLayerId = OverlayLayerId;
+	}
+
+	return MaxLayerId;
+}
+
+int32 SRadialMenu::PaintSlotOverlay(int32 SlotIndex, const FGeometry& SlotGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle) const
+{
+	const FRadialMenuSlotOverlay& SlotOverlay = SlotOverlays[SlotIndex];
+	FSlotOverlayCache& Cache = SlotOverlayCaches[SlotIndex];
+
+	const FVector2D SlotSize = SlotGeometry.GetLocalSize();
+
+	if (Cache.bDirty || Cache.SlotSize != SlotSize)
+	{
+		Cache.SlotSize = SlotSize;
+		Cache.ArcPoints.Reset();
+
+		if (SlotOverlay.Progress > 0.f)
+		{
+			// Clockwise from the top, around the slot widget
+			const FVector2D Center = SlotSize / 2;
+			const float Radius = FMath::Max(0.f, FMath::Min(SlotSize.X, SlotSize.Y) / 2.f - OverlayArcThickness / 2.f);
+			const float Progress = FMath::Min(SlotOverlay.Progress, 1.f);
+			const int32 NumPoints = FMath::Max(2, FMath::CeilToInt32(Progress * 48.f) + 1);
+
+			Cache.ArcPoints.Reserve(NumPoints);
+			for (int32 PointIndex = 0; PointIndex < NumPoints; ++PointIndex)
+			{
+				const float Angle = -UE_HALF_PI + UE_TWO_PI * Progress * PointIndex / (NumPoints - 1);
+				Cache.ArcPoints.Add(Center + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius);
+			}
+		}
+
+		Cache.CountText.Reset();
+		Cache.CountTextSize = FVector2D::ZeroVector;
+
+		if (SlotOverlay.Count != 0 && FSlateApplication::IsInitialized())
+		{
+			Cache.CountText = FString::FromInt(SlotOverlay.Count);
+			Cache.CountTextSize = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->Measure(Cache.CountText, OverlayFont);
+		}
+
+		Cache.bDirty = false;
+	}
+
+	const FLinearColor Color = OverlayColor * InWidgetStyle.GetColorAndOpacityTint();
+
+	if (Cache.ArcPoints.Num() > 1)
+	{
+		FSlateDrawElement::MakeLines(
+			OutDrawElements,
+			LayerId,
+			SlotGeometry.ToPaintGeometry(),
+			Cache.ArcPoints,
+			ESlateDrawEffect::None,
+			Color,
+			true,
+			OverlayArcThickness
+		);
+	}
+
+	if (!Cache.CountText.IsEmpty())
+	{
+		// Badge in the bottom right corner of the slot
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId,
+			SlotGeometry.ToPaintGeometry(Cache.CountTextSize, FSlateLayoutTransform(SlotSize - Cache.CountTextSize)),
+			Cache.CountText,
+			OverlayFont,
+			ESlateDrawEffect::None,
+			Color
+		);
+	}
+
+	return LayerId;
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "RadialMenu/SRadialMenu.h"
+#include "RadialMenu/RadialMenuInputRecording.h"
+#include "RadialMenu/RadialMenuInputReplay.h"
+#include "Widgets/SNullWidget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RadialMenuInputReplayTest
+{
+	/**
+	 * Stick up, stick left, then a click on the bottom sector of a 400 wide menu with four sectors.
+	 * Sectors are centred on 0 (right), 90 (up), 180 (left) and 270 (down) degrees
+	 */
+	static const TCHAR* Recording = TEXT(
+		"RadialMenuInput,400.000000,400.000000,0.000000,0.000000,1.000000\n"
+		"Time,Type,Key,Value,X,Y,PointerIndex,Touch\n"
+		"0.100000,AnalogValue,None,0.000000,0.000000,-1.000000,0,0\n"
+		"0.600000,AnalogValue,None,0.000000,-1.000000,0.000000,0,0\n"
+		"1.200000,PointerDown,LeftMouseButton,0.000000,200.000000,350.000000,0,0\n");
+
+	/** The cursor sweeps from the first sector up, then left, and the click jumps to the bottom */
+	static const TCHAR* GoldenSlots = TEXT("0 1 2 3");
+
+	static TSharedRef<SRadialMenu> MakeMenu()
+	{
+		return SNew(SRadialMenu)
+			.EnableInput(false)
+			.InstanceBackgroundMaterial(false)
+			+ SRadialMenu::Slot()[SNullWidget::NullWidget]
+			+ SRadialMenu::Slot()[SNullWidget::NullWidget]
+			+ SRadialMenu::Slot()[SNullWidget::NullWidget]
+			+ SRadialMenu::Slot()[SNullWidget::NullWidget];
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialMenuInputReplayTest, "UIGoodies.RadialMenu.InputReplay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FRadialMenuInputReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace RadialMenuInputReplayTest;
+
+	FRadialMenuInputRecording InputRecording;
+	if (!TestTrue(TEXT("Recording is parsed"), InputRecording.LoadFromString(Recording)))
+		return false;
+
+	TestEqual(TEXT("Recording events"), InputRecording.Events.Num(), 3);
+
+	const FRadialMenuReplayReport Report = FRadialMenuInputReplayer::Replay(MakeMenu(), InputRecording);
+
+	FString Slots;
+	for (const FRadialMenuReplaySelection& Selection : Report.Selections)
+	{
+		Slots += Slots.IsEmpty() ? FString::FromInt(Selection.SelectedSlot) : FString::Printf(TEXT(" %d"), Selection.SelectedSlot);
+	}
+
+	TestEqual(TEXT("Selection sequence"), Slots, FString(GoldenSlots));
+
+	// Clicks select before the tick of the frame holding them, 1.2 seconds at 60 frames per second
+	if (Report.Selections.Num() > 0)
+	{
+		TestEqual(TEXT("Click selects on its frame"), Report.Selections.Last().Frame, 72);
+	}
+
+	// Everything but the costs is deterministic
+	const FRadialMenuReplayReport SecondReport = FRadialMenuInputReplayer::Replay(MakeMenu(), InputRecording);
+	TestEqual(TEXT("Selection sequence is deterministic"), SecondReport.GetSelectionSequence(), Report.GetSelectionSequence());
+	TestEqual(TEXT("Replayed frames are deterministic"), SecondReport.ToCsv(false), Report.ToCsv(false));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
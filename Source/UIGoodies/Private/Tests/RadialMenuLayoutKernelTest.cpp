@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "RadialMenu/RadialMenuLayoutKernel.h"
+#include "RadialMenu/RadialMenuCore.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RadialMenuLayoutKernelTest
+{
+	/** VectorSinCos is a polynomial approximation, the scalar reference uses std::cos and std::sin */
+	static constexpr float DirectionTolerance = 1.e-4f;
+
+	/** Offsets scale with the radius, so they are compared relative to it */
+	static constexpr float Radius = 250.f;
+	static constexpr float MiddlePointOffset = 260.f;
+
+	/** Sentinel behind the outputs, the kernel must not write past Num */
+	static constexpr float Sentinel = -12345.f;
+
+	struct FLayoutInput
+	{
+		TArray<float> Angles;
+		TArray<float> SizesX;
+		TArray<float> SizesY;
+
+		FLayoutInput(int32 Num, int32 Seed)
+		{
+			FRandomStream Random(Seed);
+
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				// Also covers angles outside of [0, 360)
+				Angles.Add(Random.FRandRange(-720.f, 720.f));
+				SizesX.Add(Random.FRandRange(0.f, 128.f));
+				SizesY.Add(Random.FRandRange(0.f, 128.f));
+			}
+		}
+	};
+
+	struct FLayoutOutput
+	{
+		TArray<float> DirectionsX;
+		TArray<float> DirectionsY;
+		TArray<float> OffsetsX;
+		TArray<float> OffsetsY;
+
+		explicit FLayoutOutput(int32 Num)
+		{
+			DirectionsX.Init(Sentinel, Num + 1);
+			DirectionsY.Init(Sentinel, Num + 1);
+			OffsetsX.Init(Sentinel, Num + 1);
+			OffsetsY.Init(Sentinel, Num + 1);
+		}
+	};
+
+	static void RunKernel(const FLayoutInput& Input, FLayoutOutput& Output, int32 Num)
+	{
+		RadialMenuLayoutKernel::ComputeDirections(Input.Angles.GetData(), Output.DirectionsX.GetData(), Output.DirectionsY.GetData(), Num);
+		RadialMenuLayoutKernel::PlaceSlots(Output.DirectionsX.GetData(), Output.DirectionsY.GetData(), Input.SizesX.GetData(), Input.SizesY.GetData(), Radius, MiddlePointOffset, Output.OffsetsX.GetData(), Output.OffsetsY.GetData(), Num);
+	}
+
+	static void RunCore(const FLayoutInput& Input, FLayoutOutput& Output, int32 Num)
+	{
+		RadialMenuCore::ComputeDirections(Input.Angles.GetData(), Output.DirectionsX.GetData(), Output.DirectionsY.GetData(), Num);
+		RadialMenuCore::PlaceSlots(Output.DirectionsX.GetData(), Output.DirectionsY.GetData(), Input.SizesX.GetData(), Input.SizesY.GetData(), Radius, MiddlePointOffset, Output.OffsetsX.GetData(), Output.OffsetsY.GetData(), Num);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialMenuLayoutKernelTest, "UIGoodies.RadialMenu.LayoutKernel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FRadialMenuLayoutKernelTest::RunTest(const FString& Parameters)
+{
+	using namespace RadialMenuLayoutKernelTest;
+
+	// Every remainder of the four lanes, and a large count with a remainder
+	TArray<int32> Counts = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1027 };
+
+	for (const int32 Num : Counts)
+	{
+		const FLayoutInput Input(Num, Num + 1);
+
+		FLayoutOutput KernelOutput(Num);
+		FLayoutOutput CoreOutput(Num);
+		RunKernel(Input, KernelOutput, Num);
+		RunCore(Input, CoreOutput, Num);
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const bool bDirectionsMatch = FMath::IsNearlyEqual(KernelOutput.DirectionsX[Index], CoreOutput.DirectionsX[Index], DirectionTolerance)
+				&& FMath::IsNearlyEqual(KernelOutput.DirectionsY[Index], CoreOutput.DirectionsY[Index], DirectionTolerance);
+
+			// Same direction error, scaled by the distance from the centre
+			const bool bOffsetsMatch = FMath::IsNearlyEqual(KernelOutput.OffsetsX[Index], CoreOutput.OffsetsX[Index], DirectionTolerance * Radius)
+				&& FMath::IsNearlyEqual(KernelOutput.OffsetsY[Index], CoreOutput.OffsetsY[Index], DirectionTolerance * Radius);
+
+			if (!bDirectionsMatch || !bOffsetsMatch)
+			{
+				if (NumMismatches == 0)
+				{
+					AddError(FString::Printf(TEXT("Num %d, index %d: kernel (%f, %f) at (%f, %f), core (%f, %f) at (%f, %f)"), Num, Index,
+						KernelOutput.DirectionsX[Index], KernelOutput.DirectionsY[Index], KernelOutput.OffsetsX[Index], KernelOutput.OffsetsY[Index],
+						CoreOutput.DirectionsX[Index], CoreOutput.DirectionsY[Index], CoreOutput.OffsetsX[Index], CoreOutput.OffsetsY[Index]));
+				}
+				++NumMismatches;
+			}
+		}
+
+		TestEqual(FString::Printf(TEXT("Num %d: kernel matches the scalar core"), Num), NumMismatches, 0);
+
+		TestTrue(FString::Printf(TEXT("Num %d: kernel stays within the arrays"), Num),
+			KernelOutput.DirectionsX[Num] == Sentinel && KernelOutput.DirectionsY[Num] == Sentinel && KernelOutput.OffsetsX[Num] == Sentinel && KernelOutput.OffsetsY[Num] == Sentinel);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialMenuLayoutKernelBenchmark, "UIGoodies.RadialMenu.LayoutKernelBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FRadialMenuLayoutKernelBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RadialMenuLayoutKernelTest;
+
+	static constexpr int32 NumElementsPerRun = 1 << 20;
+
+	TArray<int32> Counts = { 4, 8, 16, 64, 1027 };
+
+	for (const int32 Num : Counts)
+	{
+		const FLayoutInput Input(Num, Num);
+		FLayoutOutput Output(Num);
+
+		const int32 Iterations = FMath::Max(NumElementsPerRun / Num, 1);
+
+		const double KernelStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			RunKernel(Input, Output, Num);
+		}
+		const double KernelSeconds = FPlatformTime::Seconds() - KernelStart;
+
+		const double CoreStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			RunCore(Input, Output, Num);
+		}
+		const double CoreSeconds = FPlatformTime::Seconds() - CoreStart;
+
+		AddInfo(FString::Printf(TEXT("%4d slots: kernel %.2f ns, core %.2f ns per slot, %.2fx"), Num,
+			KernelSeconds * 1.e9 / (double(Iterations) * Num), CoreSeconds * 1.e9 / (double(Iterations) * Num),
+			KernelSeconds > 0.0 ? CoreSeconds / KernelSeconds : 0.0));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "RadialMenu/SRadialMenu.h"
+#include "Widgets/SNullWidget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialMenuMoveSlotTest, "UIGoodies.RadialMenu.MoveSlot", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FRadialMenuMoveSlotTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<SRadialMenu> RadialMenu = SNew(SRadialMenu)
+		.EnableInput(false)
+		.InstanceBackgroundMaterial(false);
+
+	for (int32 SlotIndex = 0; SlotIndex < 6; ++SlotIndex)
+	{
+		RadialMenu->AddSlot()[SNullWidget::NullWidget];
+	}
+
+	// Overlays only on the first three slots, and a mask shorter than the slots
+	for (int32 SlotIndex = 0; SlotIndex < 3; ++SlotIndex)
+	{
+		FRadialMenuSlotOverlay Overlay;
+		Overlay.Count = 10 + SlotIndex;
+		RadialMenu->SetSlotOverlay(SlotIndex, Overlay);
+	}
+
+	TBitArray<> SlotMask;
+	SlotMask.Add(true);
+	SlotMask.Add(false);
+	SlotMask.Add(true);
+	SlotMask.Add(false);
+	RadialMenu->SetSlotMask(SlotMask);
+
+	// Slots are now in the former order 0, 5, 1, 2, 3, 4
+	RadialMenu->MoveSlot(5, 1);
+
+	const int32 ExpectedCounts[] = { 10, 0, 11, 12, 0, 0 };
+	const bool ExpectedVisible[] = { true, true, false, true, false, true };
+
+	for (int32 SlotIndex = 0; SlotIndex < 6; ++SlotIndex)
+	{
+		TestEqual(FString::Printf(TEXT("Overlay of slot %d follows its slot"), SlotIndex), RadialMenu->GetSlotOverlay(SlotIndex).Count, ExpectedCounts[SlotIndex]);
+		TestEqual(FString::Printf(TEXT("Mask of slot %d follows its slot"), SlotIndex), RadialMenu->IsSlotVisible(SlotIndex), ExpectedVisible[SlotIndex]);
+	}
+
+	// And back, the slots return to their original overlays and mask
+	RadialMenu->MoveSlot(1, 5);
+
+	const int32 OriginalCounts[] = { 10, 11, 12, 0, 0, 0 };
+	const bool OriginalVisible[] = { true, false, true, false, true, true };
+
+	for (int32 SlotIndex = 0; SlotIndex < 6; ++SlotIndex)
+	{
+		TestEqual(FString::Printf(TEXT("Overlay of slot %d is restored"), SlotIndex), RadialMenu->GetSlotOverlay(SlotIndex).Count, OriginalCounts[SlotIndex]);
+		TestEqual(FString::Printf(TEXT("Mask of slot %d is restored"), SlotIndex), RadialMenu->IsSlotVisible(SlotIndex), OriginalVisible[SlotIndex]);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "RadialMenu/RadialMenu.h"
+#include "RadialMenu/SRadialMenu.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace RadialMenuPropertySyncTest
+{
+	/** Same notifications FObjectEditorUtils::MigratePropertyValue sends when the designer copies a template edit to the preview */
+	template <typename ValueType>
+	static void MigrateProperty(URadialMenu& RadialMenu, FName PropertyName, const ValueType& Value)
+	{
+		FProperty* Property = FindFProperty<FProperty>(URadialMenu::StaticClass(), PropertyName);
+		check(Property);
+
+		RadialMenu.PreEditChange(Property);
+		*Property->ContainerPtrToValuePtr<ValueType>(&RadialMenu) = Value;
+
+		FPropertyChangedEvent PropertyChangedEvent(Property);
+		RadialMenu.PostEditChangeProperty(PropertyChangedEvent);
+	}
+
+	/** Change the property without notifying the menu */
+	template <typename ValueType>
+	static void SetPropertySilently(URadialMenu& RadialMenu, FName PropertyName, const ValueType& Value)
+	{
+		FProperty* Property = FindFProperty<FProperty>(URadialMenu::StaticClass(), PropertyName);
+		check(Property);
+
+		*Property->ContainerPtrToValuePtr<ValueType>(&RadialMenu) = Value;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialMenuPropertySyncTest, "UIGoodies.RadialMenu.PropertySync", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRadialMenuPropertySyncTest::RunTest(const FString& Parameters)
+{
+	using namespace RadialMenuPropertySyncTest;
+
+	const FName StartingAngleName = TEXT("StartingAngle");
+	const FName LODName = TEXT("LOD");
+
+	URadialMenu* RadialMenu = NewObject<URadialMenu>(GetTransientPackage());
+	SetPropertySilently(*RadialMenu, StartingAngleName, 90.f);
+
+	// Stands in for the designer preview, the instance with a live slate widget
+	const TSharedRef<SRadialMenu> SlateMenu = StaticCastSharedRef<SRadialMenu>(RadialMenu->TakeWidget());
+	TestEqual(TEXT("Built with the starting angle"), SlateMenu->GetSectorTable().GetStartingAngle(), 90.f);
+
+	// Only the migrated property reaches the slate widget
+	SetPropertySilently(*RadialMenu, StartingAngleName, 0.f);
+	MigrateProperty(*RadialMenu, LODName, ERadialMenuLOD::Reduced);
+
+	TestEqual(TEXT("Migrated property is synchronized"), SlateMenu->GetLOD(), ERadialMenuLOD::Reduced);
+	TestEqual(TEXT("Other properties are left alone"), SlateMenu->GetSectorTable().GetStartingAngle(), 90.f);
+
+	// Outside of a property edit everything is synchronized
+	RadialMenu->SynchronizeProperties();
+	TestEqual(TEXT("Full synchronization pushes every property"), SlateMenu->GetSectorTable().GetStartingAngle(), 0.f);
+
+	RadialMenu->ReleaseSlateResources(true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "RadialMenu/SRadialMenu.h"
+#include "RadialMenu/RadialMenuInputProcessor.h"
+#include "Input/Events.h"
+#include "Widgets/SNullWidget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RadialMenuTouchInputTest
+{
+	static const FVector2D MenuSize(400.f, 400.f);
+
+	static FPointerEvent MakeTouchEvent(uint32 PointerIndex, FVector2D Position)
+	{
+		return FPointerEvent(0, PointerIndex, Position, Position, 1.f, true);
+	}
+
+	/** Screen position towards the centre of the sector, at a part of the radius */
+	static FVector2D GetSectorPosition(SRadialMenu& RadialMenu, int32 SlotIndex, float RadiusPart)
+	{
+		const RadialMenuCore::FVec2 Direction = RadialMenuCore::AngleToDirection(RadialMenu.GetSlotAngle(SlotIndex));
+		return MenuSize / 2 + FVector2D(Direction.X, Direction.Y) * (MenuSize.X / 2 * RadiusPart);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRadialMenuTouchInputTest, "UIGoodies.RadialMenu.TouchInput", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FRadialMenuTouchInputTest::RunTest(const FString& Parameters)
+{
+	using namespace RadialMenuTouchInputTest;
+
+	TArray<int32> ClickedSlots;
+
+	// Input is driven through a processor owned by the test, the menu does not listen to the Slate application
+	TSharedRef<SRadialMenu> RadialMenu = SNew(SRadialMenu)
+		.EnableInput(false)
+		.InstanceBackgroundMaterial(false)
+		.OnSlotClicked(SRadialMenu::FOnSlotClicked::CreateLambda([&ClickedSlots](int32 SlotIndex) { ClickedSlots.Add(SlotIndex); }))
+		+ SRadialMenu::Slot()[SNullWidget::NullWidget]
+		+ SRadialMenu::Slot()[SNullWidget::NullWidget]
+		+ SRadialMenu::Slot()[SNullWidget::NullWidget]
+		+ SRadialMenu::Slot()[SNullWidget::NullWidget];
+
+	FRadialMenuInputProcessor InputProcessor(RadialMenu);
+
+	// Touches only land on a menu ticked last frame
+	RadialMenu->Tick(FGeometry::MakeRoot(MenuSize, FSlateLayoutTransform()), 0.0, 0.f);
+
+	// Press, drag to the third sector and release
+	TestTrue(TEXT("Press inside the ring is consumed"), InputProcessor.ProcessPointerDown(MakeTouchEvent(0, GetSectorPosition(*RadialMenu, 0, 0.2f))));
+	TestTrue(TEXT("Pressed touch is tracked"), InputProcessor.IsTracking());
+
+	TestFalse(TEXT("Second finger is ignored"), InputProcessor.ProcessPointerDown(MakeTouchEvent(1, GetSectorPosition(*RadialMenu, 1, 0.5f))));
+	TestFalse(TEXT("Move of the second finger is ignored"), InputProcessor.ProcessPointerMove(MakeTouchEvent(1, GetSectorPosition(*RadialMenu, 1, 0.8f))));
+
+	TestTrue(TEXT("Drag of the tracked touch is consumed"), InputProcessor.ProcessPointerMove(MakeTouchEvent(0, GetSectorPosition(*RadialMenu, 2, 0.8f))));
+	TestTrue(TEXT("Drag moves the touch position"), InputProcessor.HasTouchInput());
+
+	TestFalse(TEXT("Release of the second finger is ignored"), InputProcessor.ProcessPointerUp(MakeTouchEvent(1, GetSectorPosition(*RadialMenu, 1, 0.8f))));
+	TestTrue(TEXT("Release of the tracked touch is consumed"), InputProcessor.ProcessPointerUp(MakeTouchEvent(0, GetSectorPosition(*RadialMenu, 2, 0.8f))));
+
+	TestFalse(TEXT("Released touch is not tracked"), InputProcessor.IsTracking());
+	TestEqual(TEXT("Release confirms one sector"), ClickedSlots.Num(), 1);
+	TestEqual(TEXT("Release confirms the sector under the touch"), ClickedSlots.Num() > 0 ? ClickedSlots.Last() : INDEX_NONE, 2);
+	TestEqual(TEXT("Release selects the sector under the touch"), RadialMenu->GetSelectedSlot(), 2);
+
+	// Release in the deadzone cancels the gesture
+	TestTrue(TEXT("Second press is consumed"), InputProcessor.ProcessPointerDown(MakeTouchEvent(0, GetSectorPosition(*RadialMenu, 1, 0.8f))));
+	TestTrue(TEXT("Release in the deadzone is consumed"), InputProcessor.ProcessPointerUp(MakeTouchEvent(0, MenuSize / 2)));
+	TestEqual(TEXT("Release in the deadzone confirms nothing"), ClickedSlots.Num(), 1);
+
+	// Cancelled touch, e.g. on focus loss, frees the menu for another finger
+	InputProcessor.ProcessPointerDown(MakeTouchEvent(0, GetSectorPosition(*RadialMenu, 1, 0.5f)));
+	InputProcessor.CancelTouch();
+	TestFalse(TEXT("Cancelled touch is not tracked"), InputProcessor.IsTracking());
+	TestFalse(TEXT("Cancelled touch does not confirm its sector"), InputProcessor.ProcessPointerUp(MakeTouchEvent(0, GetSectorPosition(*RadialMenu, 1, 0.8f))));
+	TestTrue(TEXT("Another finger drives the menu after a cancel"), InputProcessor.ProcessPointerDown(MakeTouchEvent(3, GetSectorPosition(*RadialMenu, 3, 0.5f))));
+
+	// Lost end of the tracked touch, its pointer index is pressed again
+	TestTrue(TEXT("Press of the tracked pointer index restarts the tracking"), InputProcessor.ProcessPointerDown(MakeTouchEvent(3, GetSectorPosition(*RadialMenu, 0, 0.5f))));
+	TestTrue(TEXT("Restarted touch is tracked"), InputProcessor.IsTracking());
+	TestEqual(TEXT("Cancelled touches confirm nothing"), ClickedSlots.Num(), 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "UIGoodies.h"
+#include "RadialMenu/RadialMenuMaterialPool.h"
 
 #define LOCTEXT_NAMESPACE "FUIGoodiesModule"
 
@@ -12,6 +13,7 @@ void FUIGoodiesModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FRadialMenuMaterialPool::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
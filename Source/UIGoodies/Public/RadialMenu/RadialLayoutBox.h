@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PanelWidget.h"
+
+#include "RadialMenu/SRadialLayoutBox.h"
+
+#include "RadialLayoutBox.generated.h"
+
+/**
+ * UMG radial layout used slate SRadialLayoutBox.
+ * Lays out HUD elements on a circle like URadialMenu, without selection, input, tick or background material.
+ */
+UCLASS()
+class UIGOODIES_API URadialLayoutBox : public UPanelWidget
+{
+	GENERATED_BODY()
+
+public:
+	URadialLayoutBox(const FObjectInitializer& Initializer);
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	virtual void SynchronizeProperties() override;
+
+	UFUNCTION(BlueprintCallable, Category = "Layout|Radial Layout Box")
+	void SetPreferredRadius(float InPreferredRadius);
+
+	UFUNCTION(BlueprintCallable, Category = "Layout|Radial Layout Box")
+	void SetStartingAngle(float InStartingAngle);
+
+protected:
+	// UPanelWidget
+	virtual UClass* GetSlotClass() const override;
+	virtual void OnSlotAdded(UPanelSlot* Slot) override;
+	virtual void OnSlotRemoved(UPanelSlot* Slot) override;
+	// End UPanelWidget
+
+protected:
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 360))
+	float StartingAngle;
+
+	// Preferred radius from 0 to 1.
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 1))
+	float PreferredRadius = 1;
+
+	TSharedPtr<SRadialLayoutBox> MyRadialLayoutBox;
+};
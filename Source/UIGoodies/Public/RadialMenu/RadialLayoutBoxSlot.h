@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PanelSlot.h"
+#include "RadialMenu/SRadialLayoutBox.h"
+
+#include "RadialLayoutBoxSlot.generated.h"
+
+/**
+ * 
+ */
+UCLASS()
+class UIGOODIES_API URadialLayoutBoxSlot : public UPanelSlot
+{
+	GENERATED_BODY()
+
+public:
+	URadialLayoutBoxSlot(const FObjectInitializer& ObjectInitializer);
+
+	// UPanelSlot interface
+	virtual void SynchronizeProperties() override;
+	// End of UPanelSlot interface
+
+	/** Builds the underlying FSlot for the Slate layout panel. */
+	void BuildSlot(TSharedRef<SRadialLayoutBox> RadialLayoutBox);
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual void SynchronizeFromTemplate(const UPanelSlot* const TemplateSlot) override;
+#endif //WITH_EDITOR
+
+	UFUNCTION(BlueprintCallable, Category = "Layout|Radial Layout Box Slot")
+	void SetWeight(float Weight);
+
+	UFUNCTION(BlueprintGetter, Category = "Layout|Radial Layout Box Slot")
+	float GetWeight();
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintSetter = "SetWeight", BlueprintGetter = "GetWeight", Category = "Layout|Radial Layout Box Slot", meta = (ClampMin = 0))
+	float Weight;
+
+private:
+	/** A raw pointer to the slot to allow us to adjust the weight at runtime. */
+	SRadialLayoutBox::FSlot* Slot;
+};
@@ -6,15 +6,26 @@
 #include "Components/PanelWidget.h"
 #include "Components/RadialBoxSettings.h"
 #include "Blueprint/UserWidgetPool.h"
+#include "Containers/Ticker.h"
 
 #include "RadialMenu/SRadialMenu.h"
+#include "RadialMenu/RadialMenuItem.h"
+#include "RadialMenu/RadialMenuModel.h"
+#include "RadialMenu/RadialMenuSearchIndex.h"
+#include "RadialMenu/RadialMenuPrewarm.h"
 
 #include "RadialMenu.generated.h"
 
+class UEnhancedInputComponent;
+class UInputAction;
 class UMaterialInstanceDynamic;
+class URadialMenuSlot;
 class UMaterialInterface;
 class USlateBrushAsset;
 class UTexture2D;
+class SBox;
+struct FInputActionValue;
+struct FStreamableHandle;
 
 /**
  * UMG Radial menu used slate SRadialMenu
@@ -31,8 +42,67 @@ public:
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	virtual void SynchronizeProperties() override;
 
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** Remove all children and release the item entry widgets to the pool */
+	UFUNCTION(BlueprintCallable)
 	void Reset(bool bDeleteWidgets);
 
+	/**
+	 * Reconcile the menu with the keyed items.
+	 * Entries with unchanged keys keep their widgets, removed keys are released to the pool, new keys are created
+	 * from EntryWidgetClass and the slots are reordered to follow the items. The selected key stays selected.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void SetItems(const TArray<FRadialMenuItem>& Items);
+
+	/**
+	 * Apply a snapshot built by FRadialMenuModel, possibly on a worker thread.
+	 * Reconciles the items like SetItems and reuses the precomputed sectors instead of rebuilding them
+	 */
+	void ApplyModelSnapshot(const FRadialMenuModelSnapshotRef& Snapshot);
+
+	/** Entries of a progressive population are still being created */
+	UFUNCTION(BlueprintPure)
+	bool IsPopulating() const { return PendingEntrySlots.Num() > 0; }
+
+	/**
+	 * Cache the label glyphs and the icon and background brush resources, so the first open does not rasterise or load them.
+	 * Icons are loaded asynchronously and kept loaded until the next Prewarm. OnPrewarmCompleted fires with the report
+	 */
+	UFUNCTION(BlueprintCallable)
+	void Prewarm();
+
+	UFUNCTION(BlueprintPure)
+	bool IsPrewarming() const { return bPrewarming; }
+
+	/** Report of the last completed Prewarm */
+	UFUNCTION(BlueprintPure)
+	const FRadialMenuPrewarmReport& GetPrewarmReport() const { return PrewarmReport; }
+
+	/** Widget showing the selected item, nullptr until an item is first selected. One exists however many items the menu has */
+	UFUNCTION(BlueprintPure)
+	UWidget* GetDetailWidget() const { return DetailWidget; }
+
+	/** Starting angle to build FRadialMenuModel snapshots with */
+	float GetStartingAngle() const { return StartingAngle; }
+
+	/**
+	 * Show only the items whose label words or tags match every term of the query.
+	 * Short terms match word prefixes, longer terms match anywhere. Hidden items keep their widgets
+	 */
+	UFUNCTION(BlueprintCallable)
+	void SetFilterText(const FString& InFilterText);
+
+	UFUNCTION(BlueprintCallable)
+	void ClearFilter();
+
+	// Return None if no slot selected or the selected slot has no item
+	UFUNCTION(BlueprintPure)
+	FName GetSelectedItemKey();
+
 	// Return -1 if no slot selected
 	UFUNCTION(BlueprintPure)
 	int32 GetSelectedSlot();
@@ -56,6 +126,31 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SelectSlot(int32 SlotIndex);
 
+	// Replace the overlays of all slots in one call. Index matches the slot index
+	UFUNCTION(BlueprintCallable)
+	void SetSlotOverlays(const TArray<FRadialMenuSlotOverlay>& InSlotOverlays);
+
+	UFUNCTION(BlueprintCallable)
+	void SetSlotOverlay(int32 SlotIndex, const FRadialMenuSlotOverlay& InSlotOverlay);
+
+	// Step to the neighbour sector. Return -1 if no slot selected
+	UFUNCTION(BlueprintCallable)
+	int32 SelectNeighbourSlot(bool bClockwise);
+
+	// Select the sector under the compass direction. Return -1 if no slot selected
+	UFUNCTION(BlueprintCallable)
+	int32 SelectSlotInDirection(ERadialMenuDirection Direction);
+
+	UFUNCTION(BlueprintCallable)
+	void SetLOD(ERadialMenuLOD InLOD);
+
+	UFUNCTION(BlueprintPure)
+	ERadialMenuLOD GetLOD() const { return LOD; }
+
+	// Pick the LOD of a world space menu. Focused menus are always at the full LOD, unfocused ones never are
+	UFUNCTION(BlueprintCallable)
+	void UpdateLODFromView(float ViewDistance, bool bFocused);
+
 protected:
 	// UPanelWidget
 	virtual UClass* GetSlotClass() const override;
@@ -65,17 +160,129 @@ protected:
 
 	void HandleOnSelectionChanged(int32 SlotIndex);
 	void HandleOnAngleChanged(float Angle);
+	void HandleOnSlotClicked(int32 SlotIndex);
+
+	void ReconcileItems(const TArray<FRadialMenuItem>& Items, TSharedPtr<const FRadialMenuSectorTable, ESPMode::ThreadSafe> PrecomputedSectors);
+
+	/** Slot without content, its entry widget is created later by the progressive population */
+	URadialMenuSlot* AddPlaceholderSlot();
+
+	void StartPopulation();
+	void StopPopulation();
+
+	/** Create the pending entries closest to the cursor until the frame budget runs out */
+	bool TickPopulation(float DeltaTime);
+
+	/** Warm the glyphs and brushes once the icons of Prewarm are loaded */
+	void FinishPrewarm();
+
+	/**
+	 * Push one property to the slate widget, or all of them when the name is None.
+	 * Return false if the property is not pushed through a setter
+	 */
+	bool SynchronizeProperty(FName PropertyName);
+
+	/** The detail widget is built with the slate widget when a class or a factory is set */
+	bool HasDetail() const;
+
+	/** Repopulate the detail widget once the selection stays on an item for DetailDelay */
+	void RequestDetailUpdate();
+	void StopDetailUpdate();
+	bool TickDetail(float DeltaTime);
+
+	/** Show the selected item in the detail widget, creating the widget on the first call */
+	void UpdateDetail();
+
+	UWidget* CreateDetailWidget();
+
+	/** Push the visibility mask of the current filter to the slate widget */
+	void ApplyFilter();
+
+	/** Tell the entry widgets the current LOD, so they can collapse their icon */
+	void NotifyEntriesLOD();
+	void NotifyEntryLOD(UWidget* EntryWidget) const;
+
+	void BindNavigationAction();
+	void UnbindNavigationAction();
+	void HandleNavigationAction(const FInputActionValue& Value);
 
 public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnSelectionChangedNative, int32);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnAngleChangedNative, float);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnSlotClickedNative, int32);
+
+	DECLARE_MULTICAST_DELEGATE(FOnPopulationCompletedNative);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnPrewarmCompletedNative, const FRadialMenuPrewarmReport&);
+
+	/** Native listeners, called synchronously without going through reflection */
+	FOnSelectionChangedNative OnSelectionChangedNative;
+	FOnAngleChangedNative OnAngleChangedNative;
+	FOnSlotClickedNative OnSlotClickedNative;
+	FOnPopulationCompletedNative OnPopulationCompletedNative;
+	FOnPrewarmCompletedNative OnPrewarmCompletedNative;
+
+	DECLARE_DELEGATE_RetVal_OneParam(UWidget*, FOnGenerateDetailWidgetNative, URadialMenu*);
+
+	/** Native factory of the detail widget, takes precedence over OnGenerateDetailWidget and DetailWidgetClass */
+	FOnGenerateDetailWidgetNative OnGenerateDetailWidgetNative;
+
+	/** State recorded by the last tick of the slate widget, nullptr if the widget is not built */
+	const FRadialMenuFrameState* GetFrameState() const;
+
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSelectionChanged, int32, SelectedChild);
 
 	UPROPERTY(BlueprintAssignable)
 	FOnSelectionChanged OnSelectionChanged;
 
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSlotClicked, int32, ClickedChild);
+
+	UPROPERTY(BlueprintAssignable)
+	FOnSlotClicked OnSlotClicked;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPopulationCompleted);
+
+	/** Every entry of a progressive population is live */
+	UPROPERTY(BlueprintAssignable)
+	FOnPopulationCompleted OnPopulationCompleted;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPrewarmCompleted, const FRadialMenuPrewarmReport&, Report);
+
+	UPROPERTY(BlueprintAssignable)
+	FOnPrewarmCompleted OnPrewarmCompleted;
+
+	DECLARE_DYNAMIC_DELEGATE_RetVal(UWidget*, FOnGenerateDetailWidget);
+
+	/** Create the detail widget instead of DetailWidgetClass. Called once, the widget is reused for every selection */
+	UPROPERTY(EditAnywhere, Category = Events, meta = (IsBindableEvent = "True"))
+	FOnGenerateDetailWidget OnGenerateDetailWidget;
+
 	/** Brush to drag as the background */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance, meta = (DisplayName = "Brush"))
 	FSlateBrush Background;
 
+	/** Font of the slot overlay counters */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance)
+	FSlateFontInfo OverlayFont;
+
+	/** Color of the slot overlay cooldown arcs and counters */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance)
+	FLinearColor OverlayColor = FLinearColor::White;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance, meta = (ClampMin = 0))
+	float OverlayArcThickness = 3;
+
+	/** Tint of the slots disabled by their overlay */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance)
+	FLinearColor DisabledSlotTint = FLinearColor(0.3f, 0.3f, 0.3f, 0.6f);
+
+	/** Drawn in the sectors whose entry is not created yet by the progressive population */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance)
+	FSlateBrush PlaceholderBrush;
+
+	/** Fonts the entry widgets draw the item labels with. Prewarm caches the label glyphs of each */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Appearance)
+	TArray<FSlateFontInfo> LabelFonts;
+
 protected:
 	/** Settings only relevant to RadialBox */
 	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 360))
@@ -85,6 +292,7 @@ protected:
 	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 1))
 	float PreferredRadius = 1;
 
+	// Mouse movement pushes the cursor like a stick. Disable to select the sector under the hovered pointer instead
 	UPROPERTY(EditAnywhere)
 	bool bMouseAsAnalogCursor = true;
 
@@ -95,9 +303,153 @@ protected:
 	UPROPERTY(EditAnywhere)
 	EAnalogStickType StickType;
 
+	// From 0 to 1. Part of the radius where the pointer starts hitting the sectors
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 1))
+	float HitTestInnerRadius = 0;
+
+	// Part of the radius where the pointer stops hitting the sectors
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0))
+	float HitTestOuterRadius = 1;
+
+	// Broadcast the Blueprint events. Disable when only native code listens to the menu
+	UPROPERTY(EditAnywhere)
+	bool bBroadcastBlueprintEvents = true;
+
+	// Select the sector under the mouse on click. The click is not consumed, so entry buttons still receive it
+	UPROPERTY(EditAnywhere)
+	bool bSelectOnClick = true;
+
+	// 2D axis action driving the cursor. When set, StickType is ignored and raw gamepad stick events are skipped.
+	// The action is bound on the owning player's input component, so game input must reach the player.
+	UPROPERTY(EditAnywhere)
+	TObjectPtr<UInputAction> NavigationAction;
+
+	// Degrees the cursor must pass beyond the selected sector before another sector gets selected
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 45))
+	float SelectionHysteresis = 5;
+
+	// How strongly the cursor is pulled towards the centre of the selected sector
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0, ClampMax = 1))
+	float SectorMagnetism = 0;
+
+	// Seconds to look ahead along the cursor velocity when choosing a sector. Set to 0 to disable prediction
+	UPROPERTY(EditAnywhere, meta = (ClampMin = 0))
+	float SelectionPrediction = 0;
+
+	// Background material does not follow the cursor and the selection. Menus with the same material and sector count share one instance
+	UPROPERTY(EditAnywhere, Category = Appearance)
+	bool bStaticBackground = false;
+
+	// Parts of the menu that are alive. Lower levels skip input, animation, overlays or entries
+	UPROPERTY(EditAnywhere, Category = LOD)
+	ERadialMenuLOD LOD = ERadialMenuLOD::Full;
+
+	// View distance from which UpdateLODFromView drops the entries
+	UPROPERTY(EditAnywhere, Category = LOD, meta = (ClampMin = 0))
+	float MinimalLODDistance = 3000;
+
+	// Widget created for every item added through SetItems. Implement IRadialMenuEntry to receive the item data
+	UPROPERTY(EditAnywhere, Category = Entries, meta = (MustImplement = "/Script/UIGoodies.RadialMenuEntry"))
+	TSubclassOf<UUserWidget> EntryWidgetClass;
+
+	// Create the entry widgets of SetItems across frames instead of all at once. Sectors show PlaceholderBrush until their entry is live
+	UPROPERTY(EditAnywhere, Category = Entries)
+	bool bProgressivePopulation = false;
+
+	// Milliseconds per frame spent creating entries. At least one entry is created every frame
+	UPROPERTY(EditAnywhere, Category = Entries, meta = (ClampMin = 0, EditCondition = "bProgressivePopulation"))
+	float PopulationBudgetMs = 2;
+
+	// Widget describing the selected item, created on the first selection and reused. Implement IRadialMenuEntry to receive the item data.
+	// The detail is only hosted when this or a factory is set as the slate widget is built
+	UPROPERTY(EditAnywhere, Category = Detail)
+	TSubclassOf<UUserWidget> DetailWidgetClass;
+
+	// Seconds the selection must stay on an item before the detail widget is repopulated. Set to 0 to repopulate on every selection change
+	UPROPERTY(EditAnywhere, Category = Detail, meta = (ClampMin = 0))
+	float DetailDelay = 0.1f;
+
+	UPROPERTY(EditAnywhere, Category = Detail)
+	TEnumAsByte<EHorizontalAlignment> DetailHorizontalAlignment = HAlign_Center;
+
+	UPROPERTY(EditAnywhere, Category = Detail)
+	TEnumAsByte<EVerticalAlignment> DetailVerticalAlignment = VAlign_Center;
+
 	TSharedPtr<SRadialMenu> MyRadialMenu;
 
 	UPROPERTY(Transient)
-	TObjectPtr<class UMaterialInstanceDynamic> BorderDynamicMaterial;
+	FUserWidgetPool EntryWidgetPool;
+
+	/** Slots created by SetItems */
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<URadialMenuSlot>> ItemSlots;
+
+	FString FilterText;
+
+	/** Index over the item slots, rebuilt on the first filter after the items change */
+	FRadialMenuSearchIndex SearchIndex;
+
+	/** Slot index of every item in the search index */
+	TArray<int32> SearchIndexSlots;
+
+	bool bSearchIndexDirty = true;
+
+	/** Placeholder slots waiting for their entry widget. Sorted so the one closest to the cursor is last */
+	TArray<TWeakObjectPtr<URadialMenuSlot>> PendingEntrySlots;
+
+	/** Slot under the cursor when the pending slots were sorted. They are sorted again only once the cursor enters another slot */
+	int32 PendingEntriesSortSlot = INDEX_NONE;
+
+	bool bPendingEntriesSorted = false;
+
+	FTSTicker::FDelegateHandle PopulationTickerHandle;
+
+	/** Icons requested through the asset manager */
+	TSharedPtr<FStreamableHandle> PrewarmHandle;
+
+	TArray<FSoftObjectPath> PrewarmIcons;
+
+	/** Keeps the icons of the last completed Prewarm loaded until the next one completes */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> PrewarmedIcons;
+
+	/** Packages still streaming when there is no asset manager */
+	int32 NumPendingPrewarmPackages = 0;
+
+	/** Incremented by every Prewarm, so package loads of an earlier call are ignored */
+	uint32 PrewarmSerial = 0;
+
+	FRadialMenuPrewarmReport PrewarmReport;
+
+	double PrewarmStartTime = 0.0;
+
+	bool bPrewarming = false;
+
+	/** Kept to restore the overlays when the slate widget is rebuilt */
+	UPROPERTY(Transient)
+	TArray<FRadialMenuSlotOverlay> SlotOverlays;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UWidget> DetailWidget;
+
+	/** Item the detail widget was last populated with */
+	UPROPERTY(Transient)
+	FRadialMenuItem DetailItem;
+
+	bool bHasDetailItem = false;
+
+	/** Hosts the detail widget over the menu */
+	TSharedPtr<SBox> DetailBox;
+
+	FTSTicker::FDelegateHandle DetailTickerHandle;
+
+	TWeakObjectPtr<UEnhancedInputComponent> NavigationInputComponent;
+
+#if WITH_EDITOR
+	/** Property edited in the details panel while SynchronizeProperties runs for it */
+	FName EditedPropertyName;
+#endif
+
+	TArray<uint32> NavigationBindingHandles;
 
 };
@@ -0,0 +1,478 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+/*
+* Engine independent radial menu math: sectors, deadzone, cursor angle, selection, slot placement and rings.
+* Header only and plain C++ so it can be compiled, benchmarked and fuzzed without the engine.
+* SRadialMenu, SRadialLayoutBox, FRadialMenuSectorTable and FRadialMenuInputProcessor are adapters over it.
+*
+* Angles are in degrees and grow counter-clockwise, 0 points right. Vectors are in slate space (Y down).
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace RadialMenuCore
+{
+	constexpr float Pi = 3.14159265358979323846f;
+	constexpr float SmallNumber = 1.e-8f;
+
+	struct FVec2
+	{
+		float X = 0.f;
+		float Y = 0.f;
+
+		FVec2() = default;
+		FVec2(float InX, float InY) : X(InX), Y(InY) {}
+
+		FVec2 operator+(const FVec2& Other) const { return FVec2(X + Other.X, Y + Other.Y); }
+		FVec2 operator-(const FVec2& Other) const { return FVec2(X - Other.X, Y - Other.Y); }
+		FVec2 operator*(float Scale) const { return FVec2(X * Scale, Y * Scale); }
+
+		float Size() const { return std::sqrt(X * X + Y * Y); }
+	};
+
+	inline float DegreesToRadians(float Degrees) { return Degrees * (Pi / 180.f); }
+	inline float RadiansToDegrees(float Radians) { return Radians * (180.f / Pi); }
+
+	/** Angle in [0, 360) */
+	inline float ClampAxis(float Angle)
+	{
+		Angle = std::fmod(Angle, 360.f);
+		return Angle < 0.f ? Angle + 360.f : Angle;
+	}
+
+	/** Angle in (-180, 180] */
+	inline float NormalizeAxis(float Angle)
+	{
+		Angle = ClampAxis(Angle);
+		return Angle > 180.f ? Angle - 360.f : Angle;
+	}
+
+	/** Angle of a slate space vector */
+	inline float VectorToAngle(const FVec2& Vector)
+	{
+		return ClampAxis(RadiansToDegrees(std::atan2(-Vector.Y, Vector.X)));
+	}
+
+	/** Unit slate space vector pointing at the angle */
+	inline FVec2 AngleToDirection(float Angle)
+	{
+		const float Radians = DegreesToRadians(-Angle);
+		return FVec2(std::cos(Radians), std::sin(Radians));
+	}
+
+	/** Batch signature of the direction computation, so engine builds can plug a SIMD kernel into FSectorTable::Build */
+	typedef void (*FDirectionsKernel)(const float* Angles, float* OutDirectionsX, float* OutDirectionsY, int32_t Num);
+
+	/** Scalar reference of FDirectionsKernel */
+	inline void ComputeDirections(const float* Angles, float* OutDirectionsX, float* OutDirectionsY, int32_t Num)
+	{
+		for (int32_t Index = 0; Index < Num; ++Index)
+		{
+			const FVec2 Direction = AngleToDirection(Angles[Index]);
+			OutDirectionsX[Index] = Direction.X;
+			OutDirectionsY[Index] = Direction.Y;
+		}
+	}
+
+	/** Radial deadzone, the remaining range is rescaled so the output still reaches 1 */
+	inline FVec2 ApplyDeadzone(const FVec2& Value, float Deadzone)
+	{
+		const float Size = Value.Size();
+		if (Size <= 0.f)
+			return FVec2();
+
+		const float TargetSize = std::max(Size - Deadzone, 0.f) / (1.f - Deadzone);
+		return Value * (TargetSize / Size);
+	}
+
+	/** Same curve as FMath::FInterpTo, on the shortest way around the circle. Result in [0, 360) */
+	inline float InterpAngleTo(float Current, float Target, float DeltaTime, float Speed)
+	{
+		const float AngleToTarget = NormalizeAxis(Target - Current);
+
+		if (Speed <= 0.f || AngleToTarget * AngleToTarget < SmallNumber)
+			return ClampAxis(Current + AngleToTarget);
+
+		return ClampAxis(Current + AngleToTarget * std::clamp(DeltaTime * Speed, 0.f, 1.f));
+	}
+
+	/** Pull the angle towards the sector centre while it stays inside of the sector. Magnetism from 0 to 1 */
+	inline float ApplyMagnetism(float Angle, float SectorAngle, float SectorAngleWidth, float Magnetism)
+	{
+		const float AngleDifference = NormalizeAxis(SectorAngle - Angle);
+
+		if (std::abs(AngleDifference) > SectorAngleWidth * 0.5f)
+			return Angle;
+
+		return ClampAxis(Angle + AngleDifference * Magnetism);
+	}
+
+	/** Look ahead along the cursor velocity, never further than the angle the cursor is heading to */
+	inline float PredictSelectionAngle(float Current, float Target, float AngularVelocity, float Prediction)
+	{
+		const float AngleToTarget = NormalizeAxis(Target - Current);
+		const float PredictedOffset = AngularVelocity * Prediction;
+
+		if (Prediction <= 0.f || PredictedOffset * AngleToTarget <= 0.f)
+			return Current;
+
+		return Current + (AngleToTarget > 0.f ? 1.f : -1.f) * std::min(std::abs(PredictedOffset), std::abs(AngleToTarget));
+	}
+
+	/** Child placement, see SRadialMenu::FChildArranger */
+	struct FSlotPlacement
+	{
+		FVec2 Offset;
+		FVec2 Size;
+	};
+
+	/** Place a child on the circle of Radius around MiddlePointOffset, its nearest side touching the circle from the inside */
+	inline FSlotPlacement PlaceSlot(const FVec2& Direction, float Radius, float MiddlePointOffset, const FVec2& DesiredSize)
+	{
+		const float SmallestSide = std::min(DesiredSize.X / 2.f, DesiredSize.Y / 2.f);
+
+		FSlotPlacement Placement;
+		Placement.Offset.X = (Radius - SmallestSide) * Direction.X + MiddlePointOffset - DesiredSize.X / 2.f;
+		Placement.Offset.Y = (Radius - SmallestSide) * Direction.Y + MiddlePointOffset - DesiredSize.Y / 2.f;
+		Placement.Size = DesiredSize;
+
+		return Placement;
+	}
+
+	/** Scalar reference of the batched PlaceSlot, on SoA arrays */
+	inline void PlaceSlots(const float* DirectionsX, const float* DirectionsY, const float* SizesX, const float* SizesY, float Radius, float MiddlePointOffset, float* OutOffsetsX, float* OutOffsetsY, int32_t Num)
+	{
+		for (int32_t Index = 0; Index < Num; ++Index)
+		{
+			const FSlotPlacement Placement = PlaceSlot(FVec2(DirectionsX[Index], DirectionsY[Index]), Radius, MiddlePointOffset, FVec2(SizesX[Index], SizesY[Index]));
+			OutOffsetsX[Index] = Placement.Offset.X;
+			OutOffsetsY[Index] = Placement.Offset.Y;
+		}
+	}
+
+	/** Smallest width keeping the largest child clear of its neighbours in the narrowest sector, and inside the panel */
+	inline float ComputeDesiredWidth(float SmallestAngleWidth, const FVec2& LargestDesiredSize, float PreferredRadius)
+	{
+		const float LargestSide = std::max(LargestDesiredSize.X, LargestDesiredSize.Y);
+		const float SmallestSide = std::min(LargestDesiredSize.X, LargestDesiredSize.Y);
+
+		// Distance from the centre where the chord between two neighbours fits the largest child
+		const float HalfAngle = DegreesToRadians(std::clamp(SmallestAngleWidth * 0.5f, 1.f, 90.f));
+		const float CenterDistance = LargestSide / (2.f * std::sin(HalfAngle));
+
+		// Children are placed at (Width / 2 * PreferredRadius - SmallestSide / 2) from the centre and must stay inside the panel
+		const float WidthForRadius = PreferredRadius > 0.f ? 2.f * (CenterDistance + SmallestSide / 2.f) / PreferredRadius : 0.f;
+		const float WidthForBounds = 2.f * CenterDistance + LargestSide;
+
+		return std::max(WidthForRadius, WidthForBounds);
+	}
+
+	struct FRingAssignment
+	{
+		int32_t Ring = 0;
+		int32_t IndexInRing = 0;
+		int32_t NumInRing = 0;
+	};
+
+	/**
+	 * Spread slots over concentric rings, filling the inner ring first.
+	 * Ring N holds FirstRingCapacity + N * CapacityGrowth slots, the last ring takes whatever is left.
+	 */
+	inline std::vector<FRingAssignment> AssignRings(int32_t NumSlots, int32_t FirstRingCapacity, int32_t CapacityGrowth)
+	{
+		std::vector<FRingAssignment> Assignments(static_cast<size_t>(std::max(NumSlots, 0)));
+
+		const int32_t FirstCapacity = std::max(FirstRingCapacity, 1);
+		int32_t Ring = 0;
+		int32_t RingStart = 0;
+
+		while (RingStart < NumSlots)
+		{
+			const int32_t Capacity = std::max(FirstCapacity + Ring * CapacityGrowth, 1);
+			const int32_t NumInRing = std::min(Capacity, NumSlots - RingStart);
+
+			for (int32_t IndexInRing = 0; IndexInRing < NumInRing; ++IndexInRing)
+			{
+				FRingAssignment& Assignment = Assignments[RingStart + IndexInRing];
+				Assignment.Ring = Ring;
+				Assignment.IndexInRing = IndexInRing;
+				Assignment.NumInRing = NumInRing;
+			}
+
+			RingStart += NumInRing;
+			++Ring;
+		}
+
+		return Assignments;
+	}
+
+	/**
+	 * Turns mouse movement into a stick direction once the pointer travelled far enough,
+	 * blended with the previous direction to smooth out jitter.
+	 */
+	struct FMouseAnalogAccumulator
+	{
+		float Threshold = 50.f;
+
+		FVec2 Distance;
+		FVec2 LastPosition;
+
+		/** Return true and set OutAnalogValue when the accumulated movement produced a new direction */
+		bool Update(const FVec2& Position, const FVec2& CurrentAnalogValue, FVec2& OutAnalogValue)
+		{
+			Distance = Distance + (Position - LastPosition);
+			LastPosition = Position;
+
+			if (Distance.Size() <= Threshold)
+				return false;
+
+			FVec2 Direction = Normalized(Normalized(Distance) + CurrentAnalogValue);
+			Distance = FVec2();
+
+			OutAnalogValue = Direction;
+			return true;
+		}
+
+	private:
+		static FVec2 Normalized(const FVec2& Vector)
+		{
+			const float Size = Vector.Size();
+			return Size > SmallNumber ? Vector * (1.f / Size) : FVec2();
+		}
+	};
+
+	/**
+	 * Precomputed sectors: angle lookups and navigation steps are O(1).
+	 * The first sector is centred on the starting angle. Sectors with zero weight are skipped by lookups and navigation.
+	 */
+	class FSectorTable
+	{
+	public:
+		static constexpr int32_t NumLookupBins = 360;
+		static constexpr int32_t NumDirections = 8;
+
+		FSectorTable()
+		{
+			Reset();
+		}
+
+		void Build(const float* Weights, int32_t NumSectors, float InStartingAngle, FDirectionsKernel DirectionsKernel = &ComputeDirections)
+		{
+			Reset();
+
+			StartingAngle = InStartingAngle;
+
+			for (int32_t SectorIndex = 0; SectorIndex < NumSectors; ++SectorIndex)
+			{
+				TotalWeight += std::max(0.f, Weights[SectorIndex]);
+			}
+
+			Angles.assign(NumSectors, 0.f);
+			AngleWidths.assign(NumSectors, 0.f);
+			DirectionsX.assign(NumSectors, 0.f);
+			DirectionsY.assign(NumSectors, 0.f);
+			SectorEnds.assign(NumSectors, 0.f);
+			ClockwiseNeighbours.assign(NumSectors, -1);
+			CounterClockwiseNeighbours.assign(NumSectors, -1);
+
+			if (NumSectors == 0 || TotalWeight <= 0.f)
+				return;
+
+			// The first sector is centred on the starting angle
+			const float FirstAngleWidth = 360.f * std::max(0.f, Weights[0]) / TotalWeight;
+			SectorsStart = InStartingAngle - FirstAngleWidth * 0.5f;
+
+			float SectorStart = 0.f;
+
+			for (int32_t SectorIndex = 0; SectorIndex < NumSectors; ++SectorIndex)
+			{
+				const float AngleWidth = 360.f * std::max(0.f, Weights[SectorIndex]) / TotalWeight;
+				const float Angle = SectorsStart + SectorStart + AngleWidth * 0.5f;
+
+				Angles[SectorIndex] = Angle;
+				AngleWidths[SectorIndex] = AngleWidth;
+
+				SectorStart += AngleWidth;
+				SectorEnds[SectorIndex] = SectorStart;
+			}
+
+			DirectionsKernel(Angles.data(), DirectionsX.data(), DirectionsY.data(), NumSectors);
+
+			// Absorb the accumulated float error so the last non empty sector always closes the circle,
+			// otherwise angles in the gap would land on the empty sectors after it
+			int32_t LastSector = NumSectors - 1;
+			while (LastSector > 0 && AngleWidths[LastSector] <= 0.f)
+			{
+				--LastSector;
+			}
+			std::fill(SectorEnds.begin() + LastSector, SectorEnds.end(), 360.f);
+
+			AngleLookup.resize(NumLookupBins);
+
+			int32_t Sector = 0;
+			for (int32_t Bin = 0; Bin < NumLookupBins; ++Bin)
+			{
+				while (Sector < NumSectors - 1 && SectorEnds[Sector] <= Bin)
+				{
+					++Sector;
+				}
+				AngleLookup[Bin] = Sector;
+			}
+
+			// Walk the circle twice so every sector sees its closest non empty neighbour, including across the wrap
+			int32_t Previous = -1;
+			for (int32_t Step = 0; Step < NumSectors * 2; ++Step)
+			{
+				const int32_t SectorIndex = Step % NumSectors;
+				if (Step >= NumSectors)
+				{
+					ClockwiseNeighbours[SectorIndex] = Previous;
+				}
+				if (AngleWidths[SectorIndex] > 0.f)
+				{
+					Previous = SectorIndex;
+				}
+			}
+
+			int32_t Next = -1;
+			for (int32_t Step = NumSectors * 2 - 1; Step >= 0; --Step)
+			{
+				const int32_t SectorIndex = Step % NumSectors;
+				if (Step < NumSectors)
+				{
+					CounterClockwiseNeighbours[SectorIndex] = Next;
+				}
+				if (AngleWidths[SectorIndex] > 0.f)
+				{
+					Next = SectorIndex;
+				}
+			}
+
+			for (int32_t DirectionIndex = 0; DirectionIndex < NumDirections; ++DirectionIndex)
+			{
+				DirectionSectors[DirectionIndex] = FindSector(DirectionIndex * 360.f / NumDirections);
+			}
+		}
+
+		void Reset()
+		{
+			StartingAngle = 0.f;
+			SectorsStart = 0.f;
+			TotalWeight = 0.f;
+
+			Angles.clear();
+			AngleWidths.clear();
+			DirectionsX.clear();
+			DirectionsY.clear();
+			SectorEnds.clear();
+			AngleLookup.clear();
+			ClockwiseNeighbours.clear();
+			CounterClockwiseNeighbours.clear();
+
+			std::fill(std::begin(DirectionSectors), std::end(DirectionSectors), -1);
+		}
+
+		int32_t Num() const { return static_cast<int32_t>(Angles.size()); }
+
+		/** Heap bytes held by the table */
+		size_t GetAllocatedSize() const
+		{
+			return (Angles.capacity() + AngleWidths.capacity() + DirectionsX.capacity() + DirectionsY.capacity() + SectorEnds.capacity()) * sizeof(float)
+				+ (AngleLookup.capacity() + ClockwiseNeighbours.capacity() + CounterClockwiseNeighbours.capacity()) * sizeof(int32_t);
+		}
+
+		bool IsValidIndex(int32_t SectorIndex) const { return SectorIndex >= 0 && SectorIndex < Num(); }
+
+		float GetTotalWeight() const { return TotalWeight; }
+
+		float GetStartingAngle() const { return StartingAngle; }
+
+		/** Angle of the sector centre */
+		float GetAngle(int32_t SectorIndex) const { return Angles[SectorIndex]; }
+
+		float GetAngleWidth(int32_t SectorIndex) const { return AngleWidths[SectorIndex]; }
+
+		/** Unit direction to the sector centre */
+		FVec2 GetDirection(int32_t SectorIndex) const { return FVec2(DirectionsX[SectorIndex], DirectionsY[SectorIndex]); }
+
+		/** Directions of all sectors as SoA arrays of Num() floats */
+		const float* GetDirectionsX() const { return DirectionsX.data(); }
+		const float* GetDirectionsY() const { return DirectionsY.data(); }
+
+		// Return -1 if there are no sectors
+		int32_t FindSector(float Angle) const
+		{
+			if (AngleLookup.empty())
+				return -1;
+
+			const float RelativeAngle = ClampAxis(Angle - SectorsStart);
+
+			// Sectors narrower than a degree may share a bin, so step forward to the exact one
+			int32_t Sector = AngleLookup[std::clamp(static_cast<int32_t>(std::floor(RelativeAngle)), 0, NumLookupBins - 1)];
+			while (Sector < static_cast<int32_t>(SectorEnds.size()) - 1 && SectorEnds[Sector] <= RelativeAngle)
+			{
+				++Sector;
+			}
+
+			return Sector;
+		}
+
+		/**
+		 * Keep the current sector while the angle stays within its half width plus the hysteresis,
+		 * otherwise return the sector under the angle. Return -1 if there are no sectors
+		 */
+		int32_t FindSectorWithHysteresis(float Angle, int32_t CurrentSector, float Hysteresis) const
+		{
+			// Hidden sectors are never held, even with the angle right on their centre
+			if (IsValidIndex(CurrentSector) && AngleWidths[CurrentSector] > 0.f && std::abs(NormalizeAxis(Angles[CurrentSector] - Angle)) <= AngleWidths[CurrentSector] * 0.5f + Hysteresis)
+				return CurrentSector;
+
+			return FindSector(Angle);
+		}
+
+		// Return -1 if there are no sectors
+		int32_t GetNeighbour(int32_t SectorIndex, bool bClockwise) const
+		{
+			// Start from the first sector when nothing is selected yet
+			if (!IsValidIndex(SectorIndex))
+				return FindSector(SectorsStart);
+
+			return bClockwise ? ClockwiseNeighbours[SectorIndex] : CounterClockwiseNeighbours[SectorIndex];
+		}
+
+		/** Direction index from 0 (right) counter-clockwise in steps of 45 degrees. Return -1 if there are no sectors */
+		int32_t GetSectorInDirection(int32_t DirectionIndex) const
+		{
+			return DirectionIndex >= 0 && DirectionIndex < NumDirections ? DirectionSectors[DirectionIndex] : -1;
+		}
+
+	private:
+		float StartingAngle = 0.f;
+
+		/** Angle where the first sector begins */
+		float SectorsStart = 0.f;
+
+		float TotalWeight = 0.f;
+
+		std::vector<float> Angles;
+		std::vector<float> AngleWidths;
+		std::vector<float> DirectionsX;
+		std::vector<float> DirectionsY;
+
+		/** End of each sector in degrees relative to the start of the first sector */
+		std::vector<float> SectorEnds;
+
+		/** First sector overlapping each whole degree relative to the start of the first sector */
+		std::vector<int32_t> AngleLookup;
+
+		std::vector<int32_t> ClockwiseNeighbours;
+		std::vector<int32_t> CounterClockwiseNeighbours;
+
+		int32_t DirectionSectors[NumDirections];
+	};
+}
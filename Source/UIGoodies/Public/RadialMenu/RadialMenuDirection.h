@@ -0,0 +1,20 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenuDirection.generated.h"
+
+/** Compass directions in counter-clockwise order starting from the right, 45 degrees apart */
+UENUM(BlueprintType)
+enum class ERadialMenuDirection : uint8
+{
+	East,
+	NorthEast,
+	North,
+	NorthWest,
+	West,
+	SouthWest,
+	South,
+	SouthEast,
+};
@@ -5,8 +5,12 @@
 #include "CoreMinimal.h"
 #include "Framework/Application/IInputProcessor.h"
 #include "InputCoreTypes.h"
+#include "AnalogStickType.h"
+#include "CoreGlobals.h"
+#include "RadialMenu/RadialMenuCore.h"
 
 class SRadialMenu;
+class FRadialMenuInputRecorder;
 
 /*
 * Input processor for the radial menu.
@@ -21,10 +25,9 @@ public:
 	{
 		Owner = InOwner;
 
-		MouseDistance = FVector2D::Zero();
 		MousePosition = FVector2D::Zero();
-		LastMousePosition = FVector2D::Zero();
 		AnalogValue = FVector2D::Zero();
+		TouchPosition = FVector2D::Zero();
 	}
 
 	void SetOwner(TSharedPtr<SRadialMenu> InOwner)
@@ -36,60 +39,67 @@ public:
 
 	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override
 	{
-		if (bMouseAsAnalogCursor)
-		{
-			MouseDistance += MousePosition - LastMousePosition;
-			if (MouseDistance.Size() > 50)
-			{
-				MouseDistance.Normalize();
-				MouseDistance += AnalogValue;
-				MouseDistance.Normalize();
-				SetAnalogValue(MouseDistance);
-
-				MouseDistance = FVector2D::Zero();
-			}
-			LastMousePosition = MousePosition;
-		}
+		UpdateMouseAsAnalogCursor();
 	}
 
 	virtual bool HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent) override
 	{
-		FKey Key = InAnalogInputEvent.GetKey();
-		float InputAnalogValue = InAnalogInputEvent.GetAnalogValue();
+		return ProcessAnalogInput(InAnalogInputEvent.GetKey(), InAnalogInputEvent.GetAnalogValue());
+	}
 
-		if (StickType == EAnalogStickType::LeftStick)
-		{
-			if (Key == EKeys::Gamepad_LeftX)
-			{
-				AnalogValue.X = InputAnalogValue;
-			}
-			else if (Key == EKeys::Gamepad_LeftY)
-			{
-				AnalogValue.Y = -InputAnalogValue;
-			}
-		}
-		else if (StickType == EAnalogStickType::RightStick)
+	/** Mouse movement input, and drag of the tracked touch */
+	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+	{
+		return ProcessPointerMove(MouseEvent);
+	}
+
+	/** Mouse button input selects the sector under the pointer without consuming the click, a touch starts tracking */
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+	{
+		return ProcessPointerDown(MouseEvent);
+	}
+
+	/** Release of the tracked touch confirms the selection */
+	virtual bool HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+	{
+		return ProcessPointerUp(MouseEvent);
+	}
+
+	/*
+	* Input handling without the Slate application, used by the Slate handlers above and by FRadialMenuInputReplayer.
+	* Return true if the event is consumed.
+	*/
+	bool ProcessAnalogInput(const FKey& Key, float InputAnalogValue);
+	bool ProcessPointerMove(const FPointerEvent& MouseEvent);
+	bool ProcessPointerDown(const FPointerEvent& MouseEvent);
+	bool ProcessPointerUp(const FPointerEvent& MouseEvent);
+
+	/** Stop tracking the touch without confirming the selection, e.g. when its end is lost with the application focus */
+	void CancelTouch();
+
+	/** Stick value fed from outside, e.g. by an Enhanced Input action */
+	void ProcessAnalogValue(FVector2D InAnalogInput);
+
+	/** Turn the accumulated mouse movement into an analog value. Called once per frame */
+	void UpdateMouseAsAnalogCursor()
+	{
+		RadialMenuCore::FVec2 MouseAnalogValue;
+
+		if (bMouseAsAnalogCursor && MouseAnalogAccumulator.Update(RadialMenuCore::FVec2(MousePosition.X, MousePosition.Y), RadialMenuCore::FVec2(AnalogValue.X, AnalogValue.Y), MouseAnalogValue))
 		{
-			if (Key == EKeys::Gamepad_RightX)
-			{
-				AnalogValue.X = InputAnalogValue;
-			}
-			else if (Key == EKeys::Gamepad_RightY)
-			{
-				AnalogValue.Y = -InputAnalogValue;
-			}
+			SetAnalogValue(FVector2D(MouseAnalogValue.X, MouseAnalogValue.Y));
 		}
-		bHasAnalogInput = true;
-
-		return false;
 	}
 
-	/** Mouse movement input */
-	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+	/** Capture every processed input event. Null stops the recording */
+	void SetRecorder(TSharedPtr<FRadialMenuInputRecorder> InRecorder)
 	{
-		SetMousePosition(MouseEvent.GetScreenSpacePosition());
+		Recorder = InRecorder;
+	}
 
-		return false;
+	TSharedPtr<FRadialMenuInputRecorder> GetRecorder() const
+	{
+		return Recorder;
 	}
 
 	FVector2D GetAnalogValue()
@@ -103,12 +113,33 @@ public:
 	{
 		bHasAnalogInput = true;
 		AnalogValue = InAnalogInput;
+		MarkInput();
 	}
 
 	void SetMousePosition(FVector2D InMousePosition)
 	{
 		bHasMouseInput = true;
 		MousePosition = InMousePosition;
+		MarkInput();
+	}
+
+	/** FPlatformTime::Seconds() of the last input that may move the cursor */
+	double GetLastInputTime() const
+	{
+		return LastInputTime;
+	}
+
+	/** GFrameCounter of the last input that may move the cursor */
+	uint64 GetLastInputFrame() const
+	{
+		return LastInputFrame;
+	}
+
+	/** Remember when the input arrived, for the input to selection latency */
+	void MarkInput()
+	{
+		LastInputTime = FPlatformTime::Seconds();
+		LastInputFrame = GFrameCounter;
 	}
 
 	FVector2D GetMousePosition()
@@ -117,6 +148,23 @@ public:
 		return MousePosition;
 	}
 
+	FVector2D GetTouchPosition()
+	{
+		bHasTouchInput = false;
+		return TouchPosition;
+	}
+
+	bool HasTouchInput() const
+	{
+		return bHasTouchInput;
+	}
+
+	/** Return true while a finger drives the menu */
+	bool IsTracking() const
+	{
+		return TouchPointerIndex != INDEX_NONE;
+	}
+
 	bool HasAnalogInput() const
 	{
 		return bHasAnalogInput;
@@ -142,21 +190,43 @@ public:
 		StickType = InStickType;
 	}
 
+	/** Disable to ignore raw gamepad stick events and feed the analog value through SetAnalogValue only */
+	void SetAnalogStickEnabled(bool bInAnalogStickEnabled)
+	{
+		bAnalogStickEnabled = bInAnalogStickEnabled;
+	}
+
+	bool IsAnalogStickEnabled() const
+	{
+		return bAnalogStickEnabled;
+	}
+
 private:
 	TWeakPtr<SRadialMenu> Owner;
 
+	TSharedPtr<FRadialMenuInputRecorder> Recorder;
+
 	EAnalogStickType StickType;
 
 	FVector2D AnalogValue;
 
 	FVector2D MousePosition;
 
-	FVector2D LastMousePosition;
+	RadialMenuCore::FMouseAnalogAccumulator MouseAnalogAccumulator;
 
-	FVector2D MouseDistance;
+	FVector2D TouchPosition;
+
+	/** Pointer index of the finger that drives the menu, other fingers are ignored */
+	int32 TouchPointerIndex = INDEX_NONE;
 
 	bool bMouseAsAnalogCursor = false;
 
+	bool bAnalogStickEnabled = true;
+
 	bool bHasAnalogInput = false;
 	bool bHasMouseInput = false;
+	bool bHasTouchInput = false;
+
+	double LastInputTime = 0.0;
+	uint64 LastInputFrame = 0;
 };
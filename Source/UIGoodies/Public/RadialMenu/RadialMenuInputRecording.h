@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "Layout/Geometry.h"
+
+struct FPointerEvent;
+
+enum class ERadialMenuRecordedInputType : uint8
+{
+	/** Raw gamepad axis event. Key and Value */
+	AnalogAxis,
+	/** Stick value fed from outside, e.g. by an Enhanced Input action. Position holds the value */
+	AnalogValue,
+	PointerMove,
+	PointerDown,
+	PointerUp,
+};
+
+/** One input event seen by FRadialMenuInputProcessor */
+struct FRadialMenuRecordedInput
+{
+	/** Seconds since the recording started */
+	double Time = 0.0;
+
+	ERadialMenuRecordedInputType Type = ERadialMenuRecordedInputType::AnalogAxis;
+
+	/** Axis of the analog event, effecting button of the pointer event */
+	FKey Key;
+
+	float Value = 0.f;
+
+	/** Screen space position of the pointer events */
+	FVector2D Position = FVector2D::ZeroVector;
+
+	int32 PointerIndex = 0;
+
+	bool bTouch = false;
+};
+
+/**
+ * Timestamped input stream of one radial menu and the geometry the menu had when it was recorded.
+ * Saved as a small CSV file so recordings can be kept next to the golden replay results.
+ */
+struct UIGOODIES_API FRadialMenuInputRecording
+{
+	/** Local size of the menu */
+	FVector2D MenuSize = FVector2D(512.f, 512.f);
+
+	/** Screen space position of the menu top left corner */
+	FVector2D MenuPosition = FVector2D::ZeroVector;
+
+	/** Local to screen space scale, e.g. DPI scale */
+	float MenuScale = 1.f;
+
+	TArray<FRadialMenuRecordedInput> Events;
+
+	/** Geometry matching the recorded one, positions of the pointer events are relative to it */
+	FGeometry MakeMenuGeometry() const;
+
+	double GetDuration() const { return Events.Num() > 0 ? Events.Last().Time : 0.0; }
+
+	bool SaveToFile(const FString& FilePath) const;
+
+	bool LoadFromFile(const FString& FilePath);
+
+	/** Parse the CSV content written by SaveToFile */
+	bool LoadFromString(const FString& Csv);
+};
+
+/**
+ * Captures the input stream of a radial menu, see SRadialMenu::StartInputRecording.
+ * Game thread only.
+ */
+class UIGOODIES_API FRadialMenuInputRecorder
+{
+public:
+	explicit FRadialMenuInputRecorder(const FGeometry& MenuGeometry);
+
+	void RecordAnalogAxis(const FKey& Key, float Value);
+
+	void RecordAnalogValue(FVector2D Value);
+
+	void RecordPointerEvent(ERadialMenuRecordedInputType Type, const FPointerEvent& PointerEvent);
+
+	const FRadialMenuInputRecording& GetRecording() const { return Recording; }
+
+private:
+	FRadialMenuRecordedInput& AddEvent(ERadialMenuRecordedInputType Type);
+
+	double StartTime;
+
+	FRadialMenuInputRecording Recording;
+};
@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenu/RadialMenuInputRecording.h"
+
+class SRadialMenu;
+
+struct FRadialMenuReplaySettings
+{
+	/** Fixed delta time of every replayed tick */
+	float DeltaTime = 1.f / 60.f;
+
+	/** Keep ticking after the last event so the cursor can settle */
+	float TrailingTime = 1.f;
+};
+
+struct FRadialMenuReplayFrame
+{
+	int32 Frame = 0;
+
+	int32 NumEvents = 0;
+
+	int32 SelectedSlot = INDEX_NONE;
+
+	float Angle = 0.f;
+
+	/** Cost of the input handling and the widget tick of this frame */
+	double CostMs = 0.0;
+};
+
+struct FRadialMenuReplaySelection
+{
+	int32 Frame = 0;
+
+	int32 SelectedSlot = INDEX_NONE;
+};
+
+/** Result of a replay. Everything except the costs is deterministic for a given recording, menu and settings */
+struct UIGOODIES_API FRadialMenuReplayReport
+{
+	TArray<FRadialMenuReplayFrame> Frames;
+
+	TArray<FRadialMenuReplaySelection> Selections;
+
+	double TotalCostMs = 0.0;
+
+	double MaxCostMs = 0.0;
+
+	/** "Frame:Slot" pairs, suitable for a golden output comparison */
+	FString GetSelectionSequence() const;
+
+	/** Frame, events, selection, angle and cost per frame. Costs can be left out for a golden output comparison */
+	FString ToCsv(bool bIncludeCosts = true) const;
+};
+
+/**
+ * Feeds a recorded input stream to a radial menu at a fixed delta time, without the Slate application.
+ * The menu should be freshly constructed and not on screen, so real input does not mix with the replayed one.
+ * Game thread only.
+ */
+class UIGOODIES_API FRadialMenuInputReplayer
+{
+public:
+	static FRadialMenuReplayReport Replay(const TSharedRef<SRadialMenu>& RadialMenu, const FRadialMenuInputRecording& Recording, const FRadialMenuReplaySettings& Settings = FRadialMenuReplaySettings());
+};
@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "RadialMenu/RadialMenuLOD.h"
+#include "RadialMenuItem.generated.h"
+
+/**
+ * Data of one radial menu entry, identified by its key
+ */
+USTRUCT(BlueprintType)
+struct FRadialMenuItem
+{
+	GENERATED_BODY()
+
+	// Unique identifier of the entry, used to match entries between updates
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Item")
+	FName Key;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Item")
+	FText Label;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Item")
+	TSoftObjectPtr<UObject> Icon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Item", meta = (ClampMin = 0))
+	float Weight = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Item")
+	TArray<FName> Tags;
+
+	// Game specific data of the entry
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Item")
+	TObjectPtr<UObject> Payload;
+
+	// Runs for every item on every reconcile, so labels are compared by their display string instead of a culture aware collation
+	bool operator==(const FRadialMenuItem& Other) const
+	{
+		return Key == Other.Key
+			&& Weight == Other.Weight
+			&& Icon == Other.Icon
+			&& Payload == Other.Payload
+			&& Tags == Other.Tags
+			&& (Label.IdenticalTo(Other.Label) || Label.ToString().Equals(Other.Label.ToString(), ESearchCase::CaseSensitive));
+	}
+
+	bool operator!=(const FRadialMenuItem& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+UINTERFACE(MinimalAPI, BlueprintType)
+class URadialMenuEntry : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implement on entry widgets to receive the data of the radial menu item they show
+ */
+class UIGOODIES_API IRadialMenuEntry
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintNativeEvent, Category = "Radial Menu Entry")
+	void OnRadialMenuItemSet(const FRadialMenuItem& Item);
+
+	// Called when the entry is created and whenever the menu LOD changes. Collapse the icon below the full LOD
+	UFUNCTION(BlueprintNativeEvent, Category = "Radial Menu Entry")
+	void OnRadialMenuLODChanged(ERadialMenuLOD LOD);
+};
@@ -0,0 +1,18 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenuLOD.generated.h"
+
+/** How much of a radial menu is alive. Lower levels cost less, e.g. for distant world space menus */
+UENUM(BlueprintType)
+enum class ERadialMenuLOD : uint8
+{
+	/** Input, cursor animation, entries and overlays */
+	Full,
+	/** Entries only, told to collapse their icon through IRadialMenuEntry. No input, no cursor animation and no overlays */
+	Reduced,
+	/** Background only. Entries are not measured, arranged nor painted, no tick */
+	Minimal,
+};
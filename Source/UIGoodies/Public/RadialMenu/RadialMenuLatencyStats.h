@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Timestamps of one selection, from the input event to the first paint showing it.
+ * Times are FPlatformTime::Seconds(), frames are GFrameCounter
+ */
+struct FRadialMenuLatencySample
+{
+	double InputTime = 0.0;
+	uint64 InputFrame = 0;
+
+	double SelectionTime = 0.0;
+	uint64 SelectionFrame = 0;
+
+	double BroadcastTime = 0.0;
+
+	double VisibleTime = 0.0;
+	uint64 VisibleFrame = 0;
+};
+
+/**
+ * Input to visible latency histogram of one radial menu, created when the menu tracks latency.
+ * Every sample is also reported to Unreal Insights counters and the CSV profiler.
+ * Use the RadialMenu.DumpLatency console command to write all histograms to a CSV file.
+ * Game thread only.
+ */
+class UIGOODIES_API FRadialMenuLatencyStats
+{
+public:
+	explicit FRadialMenuLatencyStats(FName InMenuName);
+	~FRadialMenuLatencyStats();
+
+	void AddSample(const FRadialMenuLatencySample& Sample);
+
+	void Reset();
+
+	int32 GetNumSamples() const { return NumSamples; }
+
+	/** Bytes of the stats, itself included */
+	SIZE_T GetAllocatedSize() const { return sizeof(*this) + Buckets.GetAllocatedSize(); }
+
+	/** Input to visible latency in milliseconds, Percentile from 0 to 1. Resolution is one histogram bucket */
+	double GetPercentileMs(float Percentile) const;
+
+	/** Append the histogram rows of this menu, see DumpAll for the columns */
+	void WriteCsvRows(FString& OutCsv) const;
+
+	/** Log p50/p99 of every live menu and write all histograms to the profiling directory */
+	static void DumpAll();
+
+private:
+	static TArray<FRadialMenuLatencyStats*>& GetRegistry();
+
+	/** One millisecond per bucket, the last one collects everything slower */
+	static constexpr int32 NumBuckets = 251;
+
+	FName MenuName;
+
+	TArray<uint32> Buckets;
+
+	int32 NumSamples = 0;
+
+	double TotalInputToSelectionMs = 0.0;
+	double TotalSelectionToBroadcastMs = 0.0;
+	double TotalInputToVisibleMs = 0.0;
+	uint64 TotalInputToVisibleFrames = 0;
+
+	double MaxInputToVisibleMs = 0.0;
+};
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenu/RadialMenuSectorTable.h"
+
+/**
+ * Shares one immutable sector table between all menus with the same weights and starting angle,
+ * e.g. hundreds of world space menus built from one definition.
+ * Tables are freed when the last menu using them lets go. Game thread only.
+ */
+class UIGOODIES_API FRadialMenuLayoutCache
+{
+public:
+	static FRadialMenuSectorTableRef FindOrBuild(TArrayView<const float> Weights, float StartingAngle);
+
+	/** Tables currently alive in the cache */
+	static int32 GetNumLayouts();
+
+private:
+	static uint32 HashLayout(TArrayView<const float> Weights, float StartingAngle)
+	{
+		uint32 Hash = GetTypeHash(StartingAngle);
+		for (float Weight : Weights)
+		{
+			Hash = HashCombineFast(Hash, GetTypeHash(Weight));
+		}
+		return Hash;
+	}
+
+	/** Lookup key over the caller's weights, so cache hits neither allocate nor copy */
+	struct FLayoutKeyView
+	{
+		TArrayView<const float> Weights;
+		float StartingAngle = 0.f;
+	};
+
+	struct FLayoutKey
+	{
+		TArray<float> Weights;
+		float StartingAngle = 0.f;
+
+		bool operator==(const FLayoutKey& Other) const
+		{
+			return StartingAngle == Other.StartingAngle && Weights == Other.Weights;
+		}
+
+		bool operator==(const FLayoutKeyView& Other) const
+		{
+			return StartingAngle == Other.StartingAngle && Weights.Num() == Other.Weights.Num()
+				&& FMemory::Memcmp(Weights.GetData(), Other.Weights.GetData(), Weights.Num() * sizeof(float)) == 0;
+		}
+
+		friend uint32 GetTypeHash(const FLayoutKey& Key)
+		{
+			return HashLayout(Key.Weights, Key.StartingAngle);
+		}
+	};
+
+	typedef TMap<FLayoutKey, TWeakPtr<const FRadialMenuSectorTable, ESPMode::ThreadSafe>> FLayoutMap;
+
+	static FLayoutMap& GetLayouts();
+
+	static void RemoveStaleLayouts();
+};
@@ -0,0 +1,19 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+* Batched radial layout math on float SoA arrays, four slots per VectorRegister.
+* Same results as the scalar RadialMenuCore::ComputeDirections and RadialMenuCore::PlaceSlots,
+* within the precision of VectorSinCos.
+*/
+namespace RadialMenuLayoutKernel
+{
+	/** Unit slate space directions of the angles in degrees */
+	UIGOODIES_API void ComputeDirections(const float* Angles, float* OutDirectionsX, float* OutDirectionsY, int32 Num);
+
+	/** Top left offsets of the children placed on the circle, see RadialMenuCore::PlaceSlot */
+	UIGOODIES_API void PlaceSlots(const float* DirectionsX, const float* DirectionsY, const float* SizesX, const float* SizesY, float Radius, float MiddlePointOffset, float* OutOffsetsX, float* OutOffsetsY, int32 Num);
+}
@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+/**
+ * Recycles the background material instances of the radial menus, keyed by parent material.
+ * Menus acquire an instance when their widget is built and release it when the widget is released,
+ * so short lived menus do not create a new instance and render resource every time they open.
+ * Menus with a static background share one instance per parent material and parameter value, e.g. the sector count.
+ * Use the RadialMenu.DumpMaterials console command to log the counters. Game thread only.
+ */
+class UIGOODIES_API FRadialMenuMaterialPool
+{
+public:
+	/** Instance owned by the caller until Release, its parameters are the parent defaults */
+	static UMaterialInstanceDynamic* Acquire(UMaterialInterface* ParentMaterial);
+
+	/** Give back an instance of Acquire. Its parameters are cleared and it is kept for the next Acquire of its parent */
+	static void Release(UMaterialInstanceDynamic* Material);
+
+	/** Instance shared by every caller with the same parent material and value of the scalar parameter. Callers must not change its parameters */
+	static UMaterialInstanceDynamic* AcquireShared(UMaterialInterface* ParentMaterial, FName ParameterName, float ParameterValue);
+
+	/** Give back an instance of AcquireShared, it is freed when its last user releases it */
+	static void ReleaseShared(UMaterialInstanceDynamic* Material);
+
+	/** Instances handed out by Acquire and not released yet */
+	static int32 GetNumLive();
+
+	/** Released instances waiting for an Acquire */
+	static int32 GetNumPooled();
+
+	/** Instances of AcquireShared that have at least one user */
+	static int32 GetNumShared();
+
+	/** Free the pooled instances. Live and shared ones are untouched */
+	static void Trim();
+
+	/** Free everything, called on module shutdown */
+	static void Shutdown();
+
+	static void DumpStats();
+};
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenu/RadialMenuItem.h"
+#include "RadialMenu/RadialMenuSectorTable.h"
+
+/**
+ * Immutable result of a menu model build: the final items and their precomputed sectors.
+ * Can be handed between threads and applied to a radial menu on the game thread in one step.
+ */
+struct FRadialMenuModelSnapshot
+{
+	FRadialMenuModelSnapshot(TArray<FRadialMenuItem>&& InItems, const FRadialMenuSectorTableRef& InSectorTable)
+		: Items(MoveTemp(InItems))
+		, SectorTable(InSectorTable)
+	{
+	}
+
+	const TArray<FRadialMenuItem> Items;
+
+	/** Shared by every menu the snapshot is applied to */
+	const FRadialMenuSectorTableRef SectorTable;
+};
+
+typedef TSharedRef<const FRadialMenuModelSnapshot, ESPMode::ThreadSafe> FRadialMenuModelSnapshotRef;
+
+/**
+ * Filters, weights and sorts a large item set into a menu snapshot.
+ * Build can run on any thread, the callbacks must not touch game thread only state.
+ * UObjects referenced by the items must be kept alive by the caller while the build is running.
+ */
+class UIGOODIES_API FRadialMenuModel
+{
+public:
+	typedef TFunction<bool(const FRadialMenuItem&)> FItemFilter;
+	typedef TFunction<float(const FRadialMenuItem&)> FItemWeight;
+	typedef TFunction<bool(const FRadialMenuItem&, const FRadialMenuItem&)> FItemPredicate;
+	typedef TFunction<void(FRadialMenuModelSnapshotRef)> FOnModelBuilt;
+
+	/** Keep only the items passing the filter. Evaluated in parallel */
+	FRadialMenuModel& SetFilter(FItemFilter InFilter) { Filter = MoveTemp(InFilter); return *this; }
+
+	/** Override the item weights. Evaluated in parallel */
+	FRadialMenuModel& SetWeight(FItemWeight InWeight) { Weight = MoveTemp(InWeight); return *this; }
+
+	/** Order of the items in the menu, stable for equal items */
+	FRadialMenuModel& SetSortPredicate(FItemPredicate InSortPredicate) { SortPredicate = MoveTemp(InSortPredicate); return *this; }
+
+	/** Must match the starting angle of the menu the snapshot is applied to */
+	FRadialMenuModel& SetStartingAngle(float InStartingAngle) { StartingAngle = InStartingAngle; return *this; }
+
+	/** Build the snapshot on the calling thread */
+	FRadialMenuModelSnapshotRef Build(TArray<FRadialMenuItem> SourceItems) const;
+
+	/** Build the snapshot on a task graph worker and call OnBuilt on the game thread */
+	void BuildAsync(TArray<FRadialMenuItem> SourceItems, FOnModelBuilt OnBuilt) const;
+
+private:
+	FItemFilter Filter;
+	FItemWeight Weight;
+	FItemPredicate SortPredicate;
+
+	float StartingAngle = 0.f;
+};
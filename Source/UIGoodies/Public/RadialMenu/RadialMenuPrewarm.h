@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenuPrewarm.generated.h"
+
+struct FSlateBrush;
+struct FSlateFontInfo;
+
+/**
+ * What URadialMenu::Prewarm warmed and how long it took
+ */
+USTRUCT(BlueprintType)
+struct UIGOODIES_API FRadialMenuPrewarmReport
+{
+	GENERATED_BODY()
+
+	// Labels shaped with every label font
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	int32 NumLabels = 0;
+
+	// Glyphs rasterised into the font atlases, a glyph already in an atlas is counted too
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	int32 NumGlyphs = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	int32 NumIcons = 0;
+
+	// Icons whose asset could not be loaded
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	int32 NumFailedIcons = 0;
+
+	// Brushes with a valid renderer resource, icons included
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	int32 NumResolvedBrushes = 0;
+
+	// Time from the Prewarm call until the icon assets are loaded. The game thread is not blocked meanwhile
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	float IconLoadMs = 0.f;
+
+	// Game thread time spent shaping and rasterising the glyphs
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	float GlyphMs = 0.f;
+
+	// Game thread time spent creating the brush resources
+	UPROPERTY(BlueprintReadOnly, Category = "Radial Menu Prewarm")
+	float BrushMs = 0.f;
+
+	FString ToString() const;
+};
+
+/**
+ * Fills the Slate font atlases and brush resources ahead of the first paint. Game thread only
+ */
+struct UIGOODIES_API FRadialMenuPrewarm
+{
+	/**
+	 * Shape the text and rasterise its glyphs into the font atlas, like painting it at the given scale would.
+	 * @returns The number of visible glyphs of the text
+	 */
+	static int32 CacheGlyphs(const FString& Text, const FSlateFontInfo& Font, float FontScale);
+
+	/** Create the renderer resource of the brush. Returns false for brushes drawing nothing or without a resource */
+	static bool ResolveBrush(const FSlateBrush& Brush);
+};
@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenu/RadialMenuItem.h"
+
+/**
+ * Search index over the labels and tags of radial menu items.
+ * Built once per item set. Short terms are matched as word prefixes, longer terms as substrings through trigrams.
+ */
+class UIGOODIES_API FRadialMenuSearchIndex
+{
+public:
+	void Build(TArrayView<const FRadialMenuItem> Items);
+
+	void Reset();
+
+	int32 Num() const { return ItemTexts.Num(); }
+
+	/**
+	 * Set a bit for every item matching all the whitespace separated terms of the query.
+	 * Empty query matches every item
+	 */
+	void Search(const FString& Query, TBitArray<>& OutMatches) const;
+
+private:
+	static uint32 MakeTrigram(const TCHAR* Chars);
+
+	void SearchTerm(const FString& Term, TBitArray<>& OutMatches) const;
+
+	struct FToken
+	{
+		FString Word;
+		int32 ItemIndex;
+	};
+
+	/** Lower case label and tags of every item, separated by spaces */
+	TArray<FString> ItemTexts;
+
+	/** Words of all items sorted for the prefix search */
+	TArray<FToken> SortedTokens;
+
+	/** Ascending indices of the items containing each trigram */
+	TMap<uint32, TArray<int32>> TrigramItems;
+};
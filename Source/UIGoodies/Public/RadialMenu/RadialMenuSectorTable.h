@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenu/RadialMenuCore.h"
+#include "RadialMenu/RadialMenuDirection.h"
+#include "RadialMenu/RadialMenuLayoutKernel.h"
+
+/**
+ * Precomputed sectors of a radial menu.
+ * Angles are in degrees and grow counter-clockwise, the first sector is centred on the starting angle.
+ * Rebuilt whenever the layout changes so that angle lookups and navigation steps are O(1).
+ * Engine types over RadialMenuCore::FSectorTable.
+ */
+struct FRadialMenuSectorTable
+{
+public:
+	/** Rebuild all sectors from the slot weights. Sectors with zero weight are skipped by lookups and navigation */
+	void Build(TArrayView<const float> Weights, float InStartingAngle) { Table.Build(Weights.GetData(), Weights.Num(), InStartingAngle, &RadialMenuLayoutKernel::ComputeDirections); }
+
+	void Reset() { Table.Reset(); }
+
+	int32 Num() const { return Table.Num(); }
+
+	bool IsValidIndex(int32 SectorIndex) const { return Table.IsValidIndex(SectorIndex); }
+
+	/** Bytes of the table, itself included */
+	SIZE_T GetAllocatedSize() const { return sizeof(*this) + Table.GetAllocatedSize(); }
+
+	float GetTotalWeight() const { return Table.GetTotalWeight(); }
+
+	/** Starting angle the table was built with */
+	float GetStartingAngle() const { return Table.GetStartingAngle(); }
+
+	/** Angle of the sector centre */
+	float GetAngle(int32 SectorIndex) const { return Table.GetAngle(SectorIndex); }
+
+	float GetAngleWidth(int32 SectorIndex) const { return Table.GetAngleWidth(SectorIndex); }
+
+	/** Unit direction to the sector centre in slate space */
+	FVector2D GetDirection(int32 SectorIndex) const
+	{
+		const RadialMenuCore::FVec2 Direction = Table.GetDirection(SectorIndex);
+		return FVector2D(Direction.X, Direction.Y);
+	}
+
+	// Return -1 if there are no sectors
+	int32 FindSector(float Angle) const { return Table.FindSector(Angle); }
+
+	// Return -1 if there are no sectors
+	int32 FindSectorWithHysteresis(float Angle, int32 CurrentSector, float Hysteresis) const { return Table.FindSectorWithHysteresis(Angle, CurrentSector, Hysteresis); }
+
+	// Return -1 if there are no sectors
+	int32 GetNeighbour(int32 SectorIndex, bool bClockwise) const { return Table.GetNeighbour(SectorIndex, bClockwise); }
+
+	// Return -1 if there are no sectors
+	int32 GetSectorInDirection(ERadialMenuDirection Direction) const { return Table.GetSectorInDirection(static_cast<int32>(Direction)); }
+
+	const RadialMenuCore::FSectorTable& GetCoreTable() const { return Table; }
+
+private:
+	RadialMenuCore::FSectorTable Table;
+};
+
+typedef TSharedRef<const FRadialMenuSectorTable, ESPMode::ThreadSafe> FRadialMenuSectorTableRef;
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/PanelSlot.h"
 #include "RadialMenu/SRadialMenu.h"
+#include "RadialMenu/RadialMenuItem.h"
 
 #include "RadialMenuSlot.generated.h"
 
@@ -38,10 +39,32 @@ public:
 	UFUNCTION(BlueprintGetter, Category = "Layout|Radial Menu Slot", meta = (ClampMin = 0, ClampMax = 1))
 	float GetWeight();
 
+	/** Set the item shown by this slot. Pushes the item to the content if it implements IRadialMenuEntry */
+	void SetItem(const FRadialMenuItem& InItem);
+
+	UFUNCTION(BlueprintPure, Category = "Layout|Radial Menu Slot")
+	const FRadialMenuItem& GetItem() const { return Item; }
+
+	/** None if the slot was not created from an item */
+	FName GetItemKey() const { return Item.Key; }
+
+	/** Live slate slot, null before the slot is built */
+	const SRadialMenu::FSlot* GetSlateSlot() const { return Slot; }
+
+	/** Angle of the sector centre, 0 before the slot is built */
+	float GetAngle() const { return Slot ? Slot->GetAngle() : 0.f; }
+
+	/** Give content to a slot created without any, e.g. a placeholder of a progressively populated menu */
+	void SetContent(UWidget* InContent);
+
 protected:
 	UPROPERTY(EditAnywhere, BlueprintSetter = "SetWeight", BlueprintGetter = "GetWeight", Category = "Layout|Radial Menu Slot")
 	float Weight;
 
+	/** Item set through URadialMenu::SetItems */
+	UPROPERTY(Transient)
+	FRadialMenuItem Item;
+
 private:
 	/** A raw pointer to the slot to allow us to adjust the size, padding...etc at runtime. */
 	SRadialMenu::FSlot* Slot;
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RadialMenuSlotOverlay.generated.h"
+
+/**
+ * Per slot state drawn by the radial menu on top of the slot widget
+ */
+USTRUCT(BlueprintType)
+struct FRadialMenuSlotOverlay
+{
+	GENERATED_BODY()
+
+	// Cooldown progress from 0 to 1, drawn as an arc around the slot. 0 hides the arc
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Slot Overlay", meta = (ClampMin = 0, ClampMax = 1))
+	float Progress = 0.f;
+
+	// Counter drawn as a badge. 0 hides the badge
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Slot Overlay")
+	int32 Count = 0;
+
+	// Disabled slots are painted with the disabled tint
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Radial Menu Slot Overlay")
+	bool bEnabled = true;
+
+	bool operator==(const FRadialMenuSlotOverlay& Other) const
+	{
+		return Progress == Other.Progress && Count == Other.Count && bEnabled == Other.bEnabled;
+	}
+
+	bool operator!=(const FRadialMenuSlotOverlay& Other) const
+	{
+		return !(*this == Other);
+	}
+};
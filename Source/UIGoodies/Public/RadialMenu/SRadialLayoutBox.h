@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "SlotBase.h"
+#include "Layout/Children.h"
+#include "Widgets/SPanel.h"
+#include "RadialMenu/RadialMenuSectorTable.h"
+
+/**
+ * Non interactive panel that lays out its children on a circle like SRadialMenu.
+ * No tick, no input and no background, so the layout is only recomputed when it gets invalidated.
+ */
+class UIGOODIES_API SRadialLayoutBox : public SPanel
+{
+	SLATE_DECLARE_WIDGET(SRadialLayoutBox, SPanel)
+
+public:
+
+	class FSlot : public TSlotBase<FSlot>
+	{
+		friend SRadialLayoutBox;
+
+	public:
+		FSlot()
+			: TSlotBase<FSlot>()
+			, WeightParam(1.0f)
+		{
+		}
+
+		SLATE_SLOT_BEGIN_ARGS(FSlot, TSlotBase<FSlot>)
+			SLATE_ARGUMENT(TOptional<float>, Weight)
+		SLATE_SLOT_END_ARGS()
+
+		void Construct(const FChildren& SlotOwner, FSlotArguments&& InArgs);
+
+		float GetWeight() const
+		{
+			return WeightParam;
+		}
+
+		void SetWeight(float Weight)
+		{
+			Weight = FMath::Max(0.f, Weight);
+			if (Weight != WeightParam)
+			{
+				WeightParam = Weight;
+				NotifySlotChanged();
+			}
+		}
+
+	private:
+		float WeightParam;
+
+		/** Notify the panel that contains this slot, if any, that the slot was changed */
+		void NotifySlotChanged();
+	};
+
+	SLATE_BEGIN_ARGS(SRadialLayoutBox)
+		: _PreferredRadius(1.f)
+		, _StartingAngle(0.f)
+		{
+			_Visibility = EVisibility::SelfHitTestInvisible;
+		}
+
+		/** The slot supported by this panel */
+		SLATE_SLOT_ARGUMENT(FSlot, Slots)
+
+		/** From 0 to 1. Part of the half width where the children are placed */
+		SLATE_ARGUMENT(float, PreferredRadius)
+
+		/** Offset of the first element in the circle in degrees */
+		SLATE_ARGUMENT(float, StartingAngle)
+
+	SLATE_END_ARGS()
+
+	SRadialLayoutBox();
+
+	static FSlot::FSlotArguments Slot();
+
+	using FScopedWidgetSlotArguments = TPanelChildren<FSlot>::FScopedWidgetSlotArguments;
+	FScopedWidgetSlotArguments AddSlot();
+
+	/** Removes a slot from this radial box which contains the specified SWidget
+	 *
+	 * @param SlotWidget The widget to match when searching through the slots
+	 * @returns The index in the children array where the slot was removed and -1 if no slot was found matching the widget
+	 */
+	int32 RemoveSlot(const TSharedRef<SWidget>& SlotWidget);
+
+	void ClearChildren();
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+
+	virtual FVector2D ComputeDesiredSize(float) const override;
+
+	virtual FChildren* GetChildren() override;
+
+	void SetPreferredRadius(float InPreferredRadius);
+
+	void SetStartingAngle(float InStartingAngle);
+
+	/** Rebuild the sectors and invalidate the layout */
+	void NotifySlotChanged();
+
+protected:
+	/** The slots that contain this panel's children. */
+	TPanelChildren<FSlot> Slots;
+
+	FRadialMenuSectorTable SectorTable;
+
+	float PreferredRadius;
+
+	/** Offset of the first element in the circle in degrees */
+	float StartingAngle;
+};
@@ -11,6 +11,42 @@
 #include "Layout/Children.h"
 #include "Widgets/SPanel.h"
 #include "RadialMenu/RadialMenuInputProcessor.h"
+#include "RadialMenu/RadialMenuSectorTable.h"
+#include "RadialMenu/RadialMenuSlotOverlay.h"
+#include "RadialMenu/RadialMenuLatencyStats.h"
+#include "RadialMenu/RadialMenuInputRecording.h"
+#include "RadialMenu/RadialMenuLOD.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Styling/CoreStyle.h"
+#include "Styling/SlateBrush.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+/**
+ * Cursor and selection state of a radial menu, recorded every tick
+ */
+struct FRadialMenuFrameState
+{
+	/** GFrameCounter of the tick that recorded the state */
+	uint64 FrameNumber = 0;
+
+	/** -1 if no slot selected */
+	int32 SelectedSlot = -1;
+
+	/** Cursor angle in degrees */
+	float Angle = 0.f;
+
+	/** Angle the cursor is moving to */
+	float TargetAngle = 0.f;
+
+	/** Smoothed cursor velocity in degrees per second */
+	float AngularVelocity = 0.f;
+
+	/** The cursor reached its target angle */
+	bool bSettled = true;
+};
 
 /**
  * Slate radial menu panel
@@ -54,66 +90,87 @@ public:
 			}
 		}
 
-		float GetAngle() const
-		{
-			return AngleParam;
-		}
+		/** Sector data is read from the sector table of the panel, 0 while the slot has no sector */
+		float GetAngle() const;
 
-		void SetAngle(float Angle)
-		{
-			AngleParam = Angle;
-		}
+		float GetAngleWidth() const;
 
-		float GetAngleWidth() const
-		{
-			return AngleWidthParam;
-		}
+		FVector2D GetDirection() const;
 
-		void SetAngleWidth(float AngleWidth)
-		{
-			AngleWidthParam = AngleWidth;
-		}
-
-		FVector2D GetDirection() const
-		{
-			return Direction;
-		}
-
-		void SetDirection(FVector2D InDirection)
-		{
-			Direction = InDirection;
-		}
+		/** Index of the slot sector in the panel sector table, refreshed whenever the sectors are rebuilt */
+		int32 GetSectorIndex() const { return SectorIndex; }
 
 	private:
-		/** The panel that contains this slot */
-		TWeakPtr<SRadialMenu> RadialMenu;
-
 		float WeightParam;
 
-		float AngleParam;
-		float AngleWidthParam;
+		int32 SectorIndex = INDEX_NONE;
 
-		FVector2D Direction;
+		/** The panel that contains this slot, nullptr before the slot is added */
+		const SRadialMenu* GetRadialMenu() const;
 
 		/** Notify that the slot was changed */
-		FORCEINLINE void NotifySlotChanged(bool bSlotLayerChanged = false)
+		void NotifySlotChanged(bool bSlotLayerChanged = false);
+	};
+
+	/** Memory held by one menu, see RadialMenu.DumpMemory */
+	struct FMemoryStats
+	{
+		int32 NumSlots = 0;
+
+		/** Slots with a widget other than the null widget */
+		int32 NumWidgets = 0;
+
+		SIZE_T SlotBytes = 0;
+
+		/** Sector table, shared by every menu of the same layout */
+		SIZE_T SectorTableBytes = 0;
+		int32 SectorTableUsers = 0;
+
+		/** Slot overlays, their paint caches and the slot mask */
+		SIZE_T OverlayBytes = 0;
+
+		SIZE_T LatencyStatsBytes = 0;
+
+		/** Background instance of the material pool, 0 or 1 */
+		int32 NumMaterials = 0;
+		bool bSharedMaterial = false;
+
+		/** Bytes of the menu, the shared sector table counted by its share */
+		SIZE_T GetTotalBytes() const
 		{
-			if (RadialMenu.IsValid())
-			{
-				RadialMenu.Pin()->NotifySlotChanged(this, bSlotLayerChanged);
-			}
+			return SlotBytes + OverlayBytes + LatencyStatsBytes + (SectorTableUsers > 0 ? SectorTableBytes / SectorTableUsers : SectorTableBytes);
 		}
 	};
 
 	DECLARE_DELEGATE_OneParam(FOnSelectionChanged, int32);
 	DECLARE_DELEGATE_OneParam(FOnAngleChanged, float);
+	DECLARE_DELEGATE_OneParam(FOnSlotClicked, int32);
 
 	SLATE_BEGIN_ARGS(SRadialMenu)
 		: _PreferredRadius(1.f)
 		, _StartingAngle(0.f)
 		, _AnalogValueDeadzone(0.5f)
 		, _CursorSpeed(10.f)
+		, _SelectionHysteresis(5.f)
+		, _SectorMagnetism(0.f)
+		, _SelectionPrediction(0.f)
+		, _HitTestInnerRadius(0.f)
+		, _HitTestOuterRadius(1.f)
+		, _SelectOnClick(true)
+		, _OverlayFont(FCoreStyle::GetDefaultFontStyle("Bold", 12))
+		, _OverlayColor(FLinearColor::White)
+		, _OverlayArcThickness(3.f)
+		, _DisabledSlotTint(FLinearColor(0.3f, 0.3f, 0.3f, 0.6f))
+		, _LOD(ERadialMenuLOD::Full)
+		, _PlaceholderBrush(nullptr)
 		, _BorderImage(FCoreStyle::Get().GetBrush("Border"))
+		, _EnableInput(true)
+		, _StickType(EAnalogStickType::LeftStick)
+		, _MouseAsAnalogCursor(true)
+		, _AnalogStickEnabled(true)
+		, _InstanceBackgroundMaterial(true)
+		, _StaticBackground(false)
+		, _TrackLatency(false)
 		{
 			_Visibility = EVisibility::SelfHitTestInvisible;
 		}
@@ -132,10 +189,69 @@ public:
 
 		SLATE_ARGUMENT(float, CursorSpeed)
 
+		/** How far in degrees the cursor must travel past the selected sector boundary before the selection changes */
+		SLATE_ARGUMENT(float, SelectionHysteresis)
+
+		/** From 0 to 1. How strongly the cursor is pulled towards the centre of the selected sector */
+		SLATE_ARGUMENT(float, SectorMagnetism)
+
+		/** Time in seconds to look ahead along the cursor velocity when choosing a sector. 0 disables the prediction */
+		SLATE_ARGUMENT(float, SelectionPrediction)
+
+		/** From 0 to 1. Pointer closer to the centre than this part of the radius does not hit any sector */
+		SLATE_ARGUMENT(float, HitTestInnerRadius)
+
+		/** From 0 to 1. Pointer further from the centre than this part of the radius does not hit any sector */
+		SLATE_ARGUMENT(float, HitTestOuterRadius)
+
+		/** Select the sector under the pointer on click or touch release */
+		SLATE_ARGUMENT(bool, SelectOnClick)
+
+		/** Font of the slot overlay counters */
+		SLATE_ARGUMENT(FSlateFontInfo, OverlayFont)
+
+		/** Color of the slot overlay cooldown arcs and counters */
+		SLATE_ARGUMENT(FLinearColor, OverlayColor)
+
+		SLATE_ARGUMENT(float, OverlayArcThickness)
+
+		/** Tint of the slots disabled by their overlay */
+		SLATE_ARGUMENT(FLinearColor, DisabledSlotTint)
+
+		/** Parts of the menu that are alive, see ERadialMenuLOD */
+		SLATE_ARGUMENT(ERadialMenuLOD, LOD)
+
+		/** Drawn in the sectors whose slot has no content yet */
+		SLATE_ARGUMENT(const FSlateBrush*, PlaceholderBrush)
+
 		SLATE_ATTRIBUTE(const FSlateBrush*, BorderImage)
 
+		/** Create and register the input processor on construction, see InitInputProcessor */
+		SLATE_ARGUMENT(bool, EnableInput)
+
+		/** Gamepad stick driving the cursor */
+		SLATE_ARGUMENT(EAnalogStickType, StickType)
+
+		SLATE_ARGUMENT(bool, MouseAsAnalogCursor)
+
+		/** Disable when the cursor is driven through SetAnalogValue */
+		SLATE_ARGUMENT(bool, AnalogStickEnabled)
+
+		/**
+		 * Draw a plain material of the border image through an instance from FRadialMenuMaterialPool, whose sector count,
+		 * selected sector angle and cursor angle parameters follow the menu. Instances given to the brush are drawn as they are
+		 */
+		SLATE_ARGUMENT(bool, InstanceBackgroundMaterial)
+
+		/** Background instance does not follow the cursor and the selection, and is shared with the menus of the same material and sector count */
+		SLATE_ARGUMENT(bool, StaticBackground)
+
+		/** Record the input to visible latency of the selections. Also enabled for every menu by RadialMenu.TrackLatency */
+		SLATE_ARGUMENT(bool, TrackLatency)
+
 		SLATE_EVENT(FOnSelectionChanged, OnSelectionChanged)
 		SLATE_EVENT(FOnAngleChanged, OnAngleChanged)
+		SLATE_EVENT(FOnSlotClicked, OnSlotClicked)
 
 	SLATE_END_ARGS()
 
@@ -157,51 +273,218 @@ public:
 	 */
 	int32 RemoveSlot(const TSharedRef<SWidget>& SlotWidget);
 
+	/** Removes the given slot, for the slots without content that can not be matched by widget
+	 *
+	 * @returns The index in the children array where the slot was removed and -1 if the slot is not in this radial box
+	 */
+	int32 RemoveSlot(const FSlot* InSlot);
+
 	void Construct(const FArguments& InArgs);
 
+	/** Create the input processor and register it to the Slate application while the menu is at the full LOD */
 	void InitInputProcessor(bool UseMouseAsAnalogCursorm, EAnalogStickType StickType);
 
+	/** Unregister and drop the input processor. Called on destruction */
+	void ReleaseInputProcessor();
+
+	TSharedPtr<FRadialMenuInputProcessor> GetInputProcessor() const { return InputProcessor; }
+
+	/** Capture the input stream of this menu, to be replayed by FRadialMenuInputReplayer */
+	void StartInputRecording();
+	FRadialMenuInputRecording StopInputRecording();
+
 	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 
 	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
 
-	virtual void CacheDesiredSize(float LayoutScaleMultiplier) override;
-
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
 	void ClearChildren();
 
+	/** Move a slot to another index, keeping its widget and the selection */
+	void MoveSlot(int32 IndexToMove, int32 IndexToDestination);
+
+	/** Defer the sector rebuild while adding, removing or moving several slots */
+	void BeginBatchUpdate();
+	void EndBatchUpdate();
+
+	/**
+	 * Hide slots without removing their widgets. Hidden slots get no sector and are not arranged.
+	 * Bit per slot, slots past the end of the mask stay visible. Empty mask shows every slot
+	 */
+	void SetSlotMask(const TBitArray<>& InSlotMask);
+
+	bool IsSlotVisible(int32 SlotIndex) const { return !SlotMask.IsValidIndex(SlotIndex) || SlotMask[SlotIndex]; }
+
+	/**
+	 * Use sectors computed elsewhere (e.g. by FRadialMenuModel on a worker thread) instead of rebuilding them.
+	 * Ignored and rebuilt if the table does not match the slots count or the starting angle
+	 */
+	void ApplySectorTable(const FRadialMenuSectorTableRef& InSectorTable);
+
+	/** Drop input, animation, overlays or entries of the menu, e.g. when it is far from the camera */
+	void SetLOD(ERadialMenuLOD InLOD);
+
+	ERadialMenuLOD GetLOD() const { return LOD; }
+
 	virtual FVector2D ComputeDesiredSize(float) const override;
 
+	/** No children at the minimal LOD, so the prepass and the layout skip the entries */
 	virtual FChildren* GetChildren() override;
 
-	void SetStartingAngle(float InStartingAngle) { StartingAngle = InStartingAngle; }
+	/** All children regardless of the LOD, for the invalidation */
+	virtual FChildren* GetAllChildren() override;
+
+	void SetStartingAngle(float InStartingAngle);
 
 	void SetAnalogValueDeadzone(float InAnalogValueDeadzone) { AnalogValueDeadzone = InAnalogValueDeadzone; }
 
-	void SetPreferredRadius(float InPreferredRadius) { PreferredRadius = InPreferredRadius; }
+	void SetPreferredRadius(float InPreferredRadius);
 
 	void SetMouseAsAnalogCursor(bool InMouseAsAnalogCursor);
 
+	/** Disable to ignore raw gamepad stick events when the cursor is driven through SetAnalogValue */
+	void SetAnalogStickEnabled(bool bInAnalogStickEnabled);
+
+	/** Feed an already processed stick value. X to the right, Y down */
+	void SetAnalogValue(FVector2D InAnalogValue);
+
 	void SetCursorSpeed(float InCursorSpeed) { CursorSpeed = InCursorSpeed; }
 
+	void SetHitTestRadius(float InInnerRadius, float InOuterRadius);
+
+	void SetSelectOnClick(bool bInSelectOnClick) { bSelectOnClick = bInSelectOnClick; }
+
+	void SetSelectionHysteresis(float InSelectionHysteresis) { SelectionHysteresis = FMath::Max(0.f, InSelectionHysteresis); }
+
+	void SetSectorMagnetism(float InSectorMagnetism) { SectorMagnetism = FMath::Clamp(InSectorMagnetism, 0.f, 1.f); }
+
+	void SetSelectionPrediction(float InSelectionPrediction) { SelectionPrediction = FMath::Max(0.f, InSelectionPrediction); }
+
 	// Return -1 if no slot selected
 	int32 GetSelectedSlot() const { return SelectedSlot; }
 	float GetCurrentAngle() const { return CurrentAngle; }
 
+	FMemoryStats GetMemoryStats() const;
+
+	/** Log the memory of every live menu */
+	static void DumpMemory();
+
+	/** Input to visible latency of the selections of this menu, nullptr until a selection is tracked */
+	const FRadialMenuLatencyStats* GetLatencyStats() const { return LatencyStats.Get(); }
+
+	void SetTrackLatency(bool bInTrackLatency) { bTrackLatency = bInTrackLatency; }
+
+	/** Latency is recorded for this menu, or for every menu through RadialMenu.TrackLatency */
+	bool IsTrackingLatency() const;
+
+	/** State recorded by the last tick, for native systems polling the menu */
+	const FRadialMenuFrameState& GetFrameState() const { return FrameState; }
+
 	float GetSlotAngle(int32 SlotIndex);
 
+	// Return -1 if no slot contains the angle
+	int32 FindSlotAtAngle(float Angle) const;
+
+	/**
+	 * Polar hit test against the sectors, independent of the child widget sizes.
+	 * Return -1 if the position is outside of the hit test ring
+	 */
+	int32 HitTestSlot(const FGeometry& Geometry, FVector2D AbsolutePosition) const;
+
+	/** Called by the input processor, which lets the click through to the widgets either way. Return true if the click selected a slot */
+	bool HandleMouseButtonDown(const FPointerEvent& MouseEvent);
+
+	/** Called by the input processor. Return true if the touch landed on the menu and should drive it */
+	bool HandleTouchStarted(const FPointerEvent& TouchEvent);
+
+	/** Called by the input processor when the tracked touch is released. Confirms the selection outside of the deadzone */
+	void HandleTouchEnded(const FPointerEvent& TouchEvent);
+
+	/**
+	 * Replace the per slot overlays in one call. Index matches the slot index.
+	 * Only slots with changed values rebuild their cached overlay, and nothing is repainted if no value changed
+	 */
+	void SetSlotOverlays(TArrayView<const FRadialMenuSlotOverlay> InSlotOverlays);
+
+	void SetSlotOverlay(int32 SlotIndex, const FRadialMenuSlotOverlay& InSlotOverlay);
+
+	/** Overlay of the slot, the default one if none was set */
+	FRadialMenuSlotOverlay GetSlotOverlay(int32 SlotIndex) const;
+
+	void SetOverlayStyle(const FSlateFontInfo& InOverlayFont, const FLinearColor& InOverlayColor, float InOverlayArcThickness, const FLinearColor& InDisabledSlotTint);
+
+	void SetPlaceholderBrush(const FSlateBrush* InPlaceholderBrush);
+
 	/** Set the image to draw for this border. */
 	void SetBorderImage(TAttribute<const FSlateBrush*> InBorderImage);
 
+	void SetStaticBackground(bool bInStaticBackground);
+
+	/** Brush painted as the background, the pooled material instance replacing the material of the border image if any */
+	const FSlateBrush* GetBackgroundBrush() const;
+
+	/** Give the background instance back to the pool, e.g. when the menu closes. Called on destruction */
+	void ReleaseBackgroundMaterial();
+
 	void SelectSlot(int32 SlotIndex);
 
+	/** Step to the next non empty sector. Returns the new selected slot */
+	int32 SelectNeighbourSlot(bool bClockwise);
+
+	/** Select the sector under the given compass direction. Returns the new selected slot */
+	int32 SelectSlotInDirection(ERadialMenuDirection Direction);
+
+	const FRadialMenuSectorTable& GetSectorTable() const { return *SectorTable; }
+
+	virtual FNavigationReply OnNavigation(const FGeometry& MyGeometry, const FNavigationEvent& InNavigationEvent) override;
+
 protected:
 	void SetSelectedSlot(int32 SlotIndex);
 
+	/** Pointer offset from the centre relative to the radius, clamped to the unit circle */
+	FVector2D GetPointerAnalogValue(const FGeometry& Geometry, FVector2D AbsolutePosition) const;
+
+	/** Picks the slot under the cursor, keeping the current one while the cursor stays within its sticky range */
+	void UpdateSelection();
+
 private:
 	void NotifySlotChanged(const FSlot* InSlot, bool bSlotLayerChanged = false);
 
+	void RemoveSlotAt(int32 SlotIdx);
+
+	static TArray<const SRadialMenu*>& GetLiveMenus();
+
+	/** Rebuild the sector table and push the sector data to the slots */
+	void UpdateSectors();
+
+	/** Push the sector data of the table to the slots */
+	void ApplySectorsToSlots();
+
+	/** Copy the cursor and selection state for GetFrameState. Called every tick */
+	void RecordFrameState();
+
+	/** Input processor receives the Slate input only at the full LOD */
+	void UpdateInputProcessorRegistration();
+
+	void UnregisterInputProcessor();
+
+	/** A touch whose end arrives while the application is inactive is never seen, so it is cancelled */
+	void HandleApplicationActivationStateChanged(const bool bIsActive);
+
+	/** Acquire, swap or release the background material instance to match the border image */
+	void UpdateBackgroundMaterial();
+	void AcquireBackgroundMaterial(UMaterialInterface* ParentMaterial);
+
+	/** Scalar parameter of the background instance, ignored for a shared one */
+	void SetBackgroundParameter(FName ParameterName, float Value);
+
+	/** Broadcast the cursor angle and push it to the background */
+	void NotifyAngleChanged();
+
+	/** Draw the cooldown arc and counter of a slot, rebuilding its cache if the overlay changed */
+	int32 PaintSlotOverlay(int32 SlotIndex, const FGeometry& SlotGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle) const;
+
 protected:
 	/** The slots that contain this panel's children. */
 	TPanelChildren<FSlot> Slots;
@@ -213,8 +496,6 @@ protected:
 	/** How wide this panel should appear to be. */
 	float PreferredRadius;
 
-	float Width;
-
 	class FChildArranger;
 	friend class SRadialMenu::FChildArranger;
 
@@ -224,16 +505,108 @@ protected:
 	float CurrentAngle;
 	float TargetAngle;
 
-	float TotalWeight;
+	/** Sectors and navigation neighbours, rebuilt whenever the layout changes. Shared with the menus of the same layout */
+	FRadialMenuSectorTableRef SectorTable;
+
+	/** Slots hidden by a filter, see SetSlotMask */
+	TBitArray<> SlotMask;
+
+	int32 BatchUpdateCount = 0;
+
+	bool bSectorsDirty = false;
 
 	float AnalogValueDeadzone;
 
 	float CursorSpeed;
 
+	float SelectionHysteresis;
+
+	float SectorMagnetism;
+
+	float SelectionPrediction;
+
+	float HitTestInnerRadius;
+
+	float HitTestOuterRadius;
+
+	bool bSelectOnClick;
+
+	/** Geometry of the last tick, the pointer input is handled against it */
+	FGeometry TickGeometry;
+
+	/** Frame of the last tick, used to ignore clicks while the menu is not on screen */
+	uint64 LastTickFrame = 0;
+
+	/** Smoothed cursor velocity in degrees per second */
+	float AngularVelocity = 0.f;
+
+	FRadialMenuFrameState FrameState;
+
+	/** Created by the first tracked selection */
+	TUniquePtr<FRadialMenuLatencyStats> LatencyStats;
+
+	bool bTrackLatency = false;
+
+	/** Selection waiting for the first paint that shows it */
+	mutable TOptional<FRadialMenuLatencySample> PendingLatencySample;
+
+	/** Values set by game code, index matches the slot index */
+	TArray<FRadialMenuSlotOverlay> SlotOverlays;
+
+	/** Paint data derived from an overlay, rebuilt only when the overlay or the slot size changes */
+	struct FSlotOverlayCache
+	{
+		TArray<FVector2D> ArcPoints;
+		FVector2D SlotSize = FVector2D::ZeroVector;
+		FString CountText;
+		FVector2D CountTextSize = FVector2D::ZeroVector;
+		bool bDirty = true;
+	};
+
+	mutable TArray<FSlotOverlayCache> SlotOverlayCaches;
+
+	FSlateFontInfo OverlayFont;
+
+	FLinearColor OverlayColor;
+
+	float OverlayArcThickness;
+
+	FLinearColor DisabledSlotTint;
+
+	const FSlateBrush* PlaceholderBrush = nullptr;
+
 	FOnSelectionChanged OnSelectionChanged;
 	FOnAngleChanged OnAngleChanged;
+	FOnSlotClicked OnSlotClicked;
 
 	TSharedPtr<FRadialMenuInputProcessor> InputProcessor;
+
+	/** Registered to the Slate application, so it receives the input */
+	bool bInputProcessorRegistered = false;
+
+	FDelegateHandle ActivationStateChangedHandle;
+
+	bool bInstanceBackgroundMaterial = true;
+
+	bool bStaticBackground = false;
+
+	/** Instance of FRadialMenuMaterialPool drawn instead of the material of the border image */
+	TStrongObjectPtr<UMaterialInstanceDynamic> BackgroundMaterial;
+
+	TWeakObjectPtr<UMaterialInterface> BackgroundParentMaterial;
+
+	/** Border image with the background instance as its resource */
+	FSlateBrush BackgroundBrush;
+
+	bool bSharedBackgroundMaterial = false;
+
+	/** Sector count the shared background instance was acquired for */
+	int32 SharedBackgroundSectorsAmount = 0;
+
+	ERadialMenuLOD LOD = ERadialMenuLOD::Full;
+
+	/** Desired size kept at the minimal LOD, where the entries are not measured */
+	FVector2D MinimalLODDesiredSize = FVector2D::ZeroVector;
 };
 
 /*
@@ -244,19 +617,39 @@ class SRadialMenu::FChildArranger
 public:
 	struct FArrangementData
 	{
+		int32 SlotIndex;
 		FVector2D SlotOffset;
 		FVector2D SlotSize;
 	};
 
 	typedef TFunctionRef<void(const FSlot& Slot, const FArrangementData& ArrangementData)> FOnSlotArranged;
 
-	static void Arrange(const SRadialMenu& RadialMenu, const FOnSlotArranged& OnSlotArranged);
+	/** Arrange the children against a panel of the given width, e.g. the allotted geometry of the arrange or paint pass */
+	static void Arrange(const SRadialMenu& RadialMenu, float Width, const FOnSlotArranged& OnSlotArranged);
+
+	/** Place one child of the given desired size on the circle, offsets are relative to the top left of the panel */
+	static FArrangementData ArrangeSlot(const FVector2D& Direction, float Radius, float MiddlePointOffset, const FVector2D& DesiredSizeOfSlot);
+
+	/** Smallest panel width that fits the children on the circle without overlapping their neighbours */
+	static float ComputeDesiredWidth(float SmallestAngleWidth, const FVector2D& LargestDesiredSizeOfSlot, float PreferredRadius);
 
 private:
-	FChildArranger(const SRadialMenu& RadialMenu, const FOnSlotArranged& OnSlotArranged);
+	FChildArranger(const SRadialMenu& RadialMenu, float Width, const FOnSlotArranged& OnSlotArranged);
 	void Arrange();
 
 	const SRadialMenu& RadialMenu;
+	const float Width;
 	const FOnSlotArranged& OnSlotArranged;
-	TMap<int32, FArrangementData> OngoingArrangementDataMap;
+
+	/** Arrange runs on every layout and paint pass, common menu sizes stay on the stack */
+	typedef TInlineAllocator<32> FSlotAllocator;
+
+	/** Arranged slots in SoA layout, input and output of the batched placement */
+	TArray<int32, FSlotAllocator> SlotIndices;
+	TArray<float, FSlotAllocator> DirectionsX;
+	TArray<float, FSlotAllocator> DirectionsY;
+	TArray<float, FSlotAllocator> SizesX;
+	TArray<float, FSlotAllocator> SizesY;
+	TArray<float, FSlotAllocator> OffsetsX;
+	TArray<float, FSlotAllocator> OffsetsY;
 };
\ No newline at end of file
@@ -39,7 +39,8 @@ public class UIGoodies : ModuleRules
 				"Slate",
 				"SlateCore",
                 "UMG",
-                "InputCore"
+                "InputCore",
+                "EnhancedInput"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+/*
+* Engine independent timings of the per frame RadialMenuCore.h paths: table build, sector lookups and slot placement.
+* Run the Release build: RadialMenuCoreBenchmark [Iterations]
+*/
+
+#include "RadialMenu/RadialMenuCore.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+
+using namespace RadialMenuCore;
+
+namespace
+{
+	/** Keeps results alive so the optimizer can not drop the measured work */
+	volatile float Sink = 0.f;
+
+	template <typename FunctionType>
+	void Measure(const char* Name, int32_t NumSectors, int32_t Iterations, FunctionType&& Function)
+	{
+		const auto Start = std::chrono::steady_clock::now();
+		for (int32_t Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Function(Iteration);
+		}
+		const auto End = std::chrono::steady_clock::now();
+
+		const double Nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Start).count());
+		std::printf("%-24s %6d sectors %12.1f ns/iteration\n", Name, NumSectors, Nanoseconds / Iterations);
+	}
+}
+
+int main(int ArgC, char** ArgV)
+{
+	const int32_t Iterations = ArgC > 1 ? std::max(std::atoi(ArgV[1]), 1) : 100000;
+
+	for (const int32_t NumSectors : { 4, 8, 16, 64, 1024 })
+	{
+		std::vector<float> Weights(NumSectors);
+		for (int32_t SectorIndex = 0; SectorIndex < NumSectors; ++SectorIndex)
+		{
+			Weights[SectorIndex] = 1.f + (SectorIndex % 3) * 0.5f;
+		}
+
+		FSectorTable Table;
+
+		// Table builds happen on layout changes, scale the count down so large tables finish quickly
+		const int32_t BuildIterations = std::max(Iterations * 4 / NumSectors, 1);
+		Measure("FSectorTable::Build", NumSectors, BuildIterations, [&](int32_t)
+		{
+			Table.Build(Weights.data(), NumSectors, 90.f);
+			Sink = Sink + Table.GetAngle(0);
+		});
+
+		Measure("FindSector", NumSectors, Iterations, [&](int32_t Iteration)
+		{
+			Sink = Sink + static_cast<float>(Table.FindSector(Iteration * 0.37f));
+		});
+
+		Measure("FindSectorWithHysteresis", NumSectors, Iterations, [&](int32_t Iteration)
+		{
+			Sink = Sink + static_cast<float>(Table.FindSectorWithHysteresis(Iteration * 0.37f, Iteration % NumSectors, 5.f));
+		});
+
+		Measure("GetNeighbour", NumSectors, Iterations, [&](int32_t Iteration)
+		{
+			Sink = Sink + static_cast<float>(Table.GetNeighbour(Iteration % NumSectors, (Iteration & 1) != 0));
+		});
+
+		std::vector<float> SizesX(NumSectors, 48.f);
+		std::vector<float> SizesY(NumSectors, 32.f);
+		std::vector<float> OffsetsX(NumSectors);
+		std::vector<float> OffsetsY(NumSectors);
+
+		const int32_t PlaceIterations = std::max(Iterations * 4 / NumSectors, 1);
+		Measure("PlaceSlots", NumSectors, PlaceIterations, [&](int32_t Iteration)
+		{
+			PlaceSlots(Table.GetDirectionsX(), Table.GetDirectionsY(), SizesX.data(), SizesY.data(), 200.f + (Iteration & 7), 200.f, OffsetsX.data(), OffsetsY.data(), NumSectors);
+			Sink = Sink + OffsetsX[NumSectors - 1];
+		});
+	}
+
+	FVec2 Value(0.3f, 0.7f);
+	float Angle = 0.f;
+	Measure("Deadzone and interp", 0, Iterations, [&](int32_t Iteration)
+	{
+		const FVec2 Input = ApplyDeadzone(Value, 0.25f);
+		Angle = InterpAngleTo(Angle, VectorToAngle(Input) + static_cast<float>(Iteration & 63), 0.016f, 20.f);
+		Value.X = -Value.X;
+		Sink = Sink + Angle;
+	});
+
+	return 0;
+}
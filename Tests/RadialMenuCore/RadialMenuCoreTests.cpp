@@ -0,0 +1,480 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+/*
+* Engine independent tests of RadialMenuCore.h, registered with ctest by the CMakeLists.txt next to this file.
+*/
+
+#include "RadialMenu/RadialMenuCore.h"
+
+#include <cstdio>
+
+using namespace RadialMenuCore;
+
+namespace
+{
+	int32_t NumFailures = 0;
+
+	void ReportFailure(const char* File, int Line, const char* Expression)
+	{
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", File, Line, Expression);
+		++NumFailures;
+	}
+
+	bool IsNearlyEqual(float A, float B, float Tolerance = 1.e-3f)
+	{
+		return std::abs(A - B) <= Tolerance;
+	}
+
+	bool IsNearlyEqualAngle(float A, float B, float Tolerance = 1.e-3f)
+	{
+		return std::abs(NormalizeAxis(A - B)) <= Tolerance;
+	}
+}
+
+#define CHECK(Expression) do { if (!(Expression)) ReportFailure(__FILE__, __LINE__, #Expression); } while (0)
+
+static void TestBuildEqualSectors()
+{
+	const float Weights[] = { 1.f, 1.f, 1.f, 1.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 4, 90.f);
+
+	CHECK(Table.Num() == 4);
+	CHECK(IsNearlyEqual(Table.GetTotalWeight(), 4.f));
+	CHECK(IsNearlyEqual(Table.GetStartingAngle(), 90.f));
+
+	// The first sector is centred on the starting angle, the others follow counter-clockwise
+	for (int32_t SectorIndex = 0; SectorIndex < 4; ++SectorIndex)
+	{
+		CHECK(IsNearlyEqual(Table.GetAngleWidth(SectorIndex), 90.f));
+		CHECK(IsNearlyEqualAngle(Table.GetAngle(SectorIndex), 90.f + SectorIndex * 90.f));
+
+		const FVec2 Direction = Table.GetDirection(SectorIndex);
+		const FVec2 Expected = AngleToDirection(Table.GetAngle(SectorIndex));
+		CHECK(IsNearlyEqual(Direction.X, Expected.X) && IsNearlyEqual(Direction.Y, Expected.Y));
+		CHECK(IsNearlyEqual(Table.GetDirectionsX()[SectorIndex], Direction.X));
+		CHECK(IsNearlyEqual(Table.GetDirectionsY()[SectorIndex], Direction.Y));
+	}
+
+	// Slate Y points down, so 90 degrees is up
+	CHECK(IsNearlyEqual(Table.GetDirection(0).X, 0.f) && IsNearlyEqual(Table.GetDirection(0).Y, -1.f));
+	CHECK(Table.GetAllocatedSize() > 0);
+}
+
+static void TestBuildEmpty()
+{
+	FSectorTable Table;
+	CHECK(Table.Num() == 0);
+	CHECK(Table.FindSector(0.f) == -1);
+	CHECK(Table.GetNeighbour(-1, true) == -1);
+	CHECK(Table.GetSectorInDirection(0) == -1);
+
+	Table.Build(nullptr, 0, 0.f);
+	CHECK(Table.Num() == 0);
+	CHECK(Table.FindSector(45.f) == -1);
+	CHECK(Table.FindSectorWithHysteresis(45.f, -1, 10.f) == -1);
+
+	// Sectors without any weight exist but can not be found
+	const float Weights[] = { 0.f, -1.f };
+	Table.Build(Weights, 2, 0.f);
+	CHECK(Table.Num() == 2);
+	CHECK(IsNearlyEqual(Table.GetTotalWeight(), 0.f));
+	CHECK(Table.FindSector(0.f) == -1);
+	CHECK(Table.GetNeighbour(0, true) == -1);
+	CHECK(Table.GetSectorInDirection(2) == -1);
+
+	Table.Reset();
+	CHECK(Table.Num() == 0);
+}
+
+static void TestBuildWeightedSectors()
+{
+	const float Weights[] = { 2.f, 1.f, 1.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 3, 0.f);
+
+	CHECK(IsNearlyEqual(Table.GetAngleWidth(0), 180.f));
+	CHECK(IsNearlyEqual(Table.GetAngleWidth(1), 90.f));
+	CHECK(IsNearlyEqual(Table.GetAngleWidth(2), 90.f));
+
+	// Sector 0 covers [-90, 90), sector 1 [90, 180) and sector 2 [180, 270)
+	CHECK(IsNearlyEqualAngle(Table.GetAngle(0), 0.f));
+	CHECK(IsNearlyEqualAngle(Table.GetAngle(1), 135.f));
+	CHECK(IsNearlyEqualAngle(Table.GetAngle(2), 225.f));
+
+	CHECK(Table.FindSector(-89.f) == 0);
+	CHECK(Table.FindSector(89.f) == 0);
+	CHECK(Table.FindSector(90.f) == 1);
+	CHECK(Table.FindSector(179.5f) == 1);
+	CHECK(Table.FindSector(180.f) == 2);
+	CHECK(Table.FindSector(269.f) == 2);
+	CHECK(Table.FindSector(270.f) == 0);
+}
+
+static void TestZeroWeightSectors()
+{
+	const float Weights[] = { 1.f, 0.f, 1.f, 1.f, 0.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 5, 0.f);
+
+	CHECK(Table.Num() == 5);
+	CHECK(IsNearlyEqual(Table.GetAngleWidth(1), 0.f));
+	CHECK(IsNearlyEqual(Table.GetAngleWidth(4), 0.f));
+
+	// Every angle lands on a sector with weight
+	for (int32_t Step = 0; Step < 3600; ++Step)
+	{
+		const int32_t Sector = Table.FindSector(Step * 0.1f);
+		CHECK(Sector == 0 || Sector == 2 || Sector == 3);
+	}
+
+	// Navigation steps over the empty sectors, also across the wrap
+	CHECK(Table.GetNeighbour(0, false) == 2);
+	CHECK(Table.GetNeighbour(2, true) == 0);
+	CHECK(Table.GetNeighbour(3, false) == 0);
+	CHECK(Table.GetNeighbour(0, true) == 3);
+	CHECK(Table.GetNeighbour(1, false) == 2);
+	CHECK(Table.GetNeighbour(4, true) == 3);
+
+	// A leading empty sector is skipped as well
+	const float LeadingWeights[] = { 0.f, 1.f, 1.f };
+	Table.Build(LeadingWeights, 3, 0.f);
+
+	CHECK(Table.FindSector(0.f) == 1);
+	CHECK(Table.FindSector(359.9f) == 2);
+	CHECK(Table.GetNeighbour(-1, false) == 1);
+	CHECK(Table.GetNeighbour(1, true) == 2);
+}
+
+static void TestTrailingZeroWeightSectors()
+{
+	// Uneven widths accumulate float error, the last visible sector must still close the circle
+	for (int32_t NumVisible = 2; NumVisible < 40; ++NumVisible)
+	{
+		std::vector<float> Weights(NumVisible + 3, 0.f);
+		for (int32_t SectorIndex = 0; SectorIndex < NumVisible; ++SectorIndex)
+		{
+			Weights[SectorIndex] = 0.1f + 0.07f * SectorIndex;
+		}
+
+		FSectorTable Table;
+		Table.Build(Weights.data(), static_cast<int32_t>(Weights.size()), 0.f);
+
+		// Just before the start of the first sector is the end of the last visible one
+		const float SectorsStart = Table.GetAngle(0) - Table.GetAngleWidth(0) * 0.5f;
+		for (int32_t Step = 1; Step < 200; ++Step)
+		{
+			const float Angle = ClampAxis(SectorsStart - Step * 1.e-5f);
+			CHECK(Table.FindSector(Angle) == NumVisible - 1 || Table.FindSector(Angle) == 0);
+			CHECK(Table.FindSectorWithHysteresis(Angle, NumVisible + 1, 0.f) < NumVisible);
+		}
+
+		for (int32_t Step = 0; Step < 3600; ++Step)
+		{
+			CHECK(Table.FindSector(Step * 0.1f) < NumVisible);
+		}
+
+		CHECK(Table.GetNeighbour(0, true) == NumVisible - 1);
+		CHECK(Table.GetNeighbour(NumVisible - 1, false) == 0);
+	}
+}
+
+static void TestFindSectorWrapAround()
+{
+	const float Weights[] = { 1.f, 1.f, 1.f, 1.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 4, 0.f);
+
+	// Sector 0 spans [-45, 45) and straddles 0/360
+	CHECK(Table.FindSector(0.f) == 0);
+	CHECK(Table.FindSector(360.f) == 0);
+	CHECK(Table.FindSector(359.99f) == 0);
+	CHECK(Table.FindSector(-0.01f) == 0);
+	CHECK(Table.FindSector(-44.9f) == 0);
+	CHECK(Table.FindSector(44.9f) == 0);
+	CHECK(Table.FindSector(45.f) == 1);
+	CHECK(Table.FindSector(314.9f) == 3);
+	CHECK(Table.FindSector(315.f) == 0);
+	CHECK(Table.FindSector(720.f + 90.f) == 1);
+	CHECK(Table.FindSector(-180.f) == 2);
+
+	// Sectors narrower than a lookup bin still resolve to the exact one
+	std::vector<float> ManyWeights(1000, 1.f);
+	Table.Build(ManyWeights.data(), static_cast<int32_t>(ManyWeights.size()), 0.f);
+
+	for (int32_t SectorIndex = 0; SectorIndex < Table.Num(); ++SectorIndex)
+	{
+		CHECK(Table.FindSector(Table.GetAngle(SectorIndex)) == SectorIndex);
+	}
+	CHECK(Table.FindSector(359.99f) == 0);
+	CHECK(Table.FindSector(0.2f) == 1);
+}
+
+static void TestFindSectorWithHysteresis()
+{
+	const float Weights[] = { 1.f, 1.f, 1.f, 1.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 4, 0.f);
+
+	// Nothing selected yet
+	CHECK(Table.FindSectorWithHysteresis(50.f, -1, 10.f) == 1);
+
+	// Sector 0 is held up to its half width plus the hysteresis
+	CHECK(Table.FindSectorWithHysteresis(50.f, 0, 10.f) == 0);
+	CHECK(Table.FindSectorWithHysteresis(54.9f, 0, 10.f) == 0);
+	CHECK(Table.FindSectorWithHysteresis(55.1f, 0, 10.f) == 1);
+	CHECK(Table.FindSectorWithHysteresis(50.f, 0, 0.f) == 1);
+
+	// Also across the wrap
+	CHECK(Table.FindSectorWithHysteresis(310.f, 0, 10.f) == 0);
+	CHECK(Table.FindSectorWithHysteresis(304.f, 0, 10.f) == 3);
+	CHECK(Table.FindSectorWithHysteresis(40.f, 3, 10.f) == 0);
+	CHECK(Table.FindSectorWithHysteresis(-50.f, 3, 10.f) == 3);
+}
+
+static void TestGetNeighbour()
+{
+	const float Weights[] = { 1.f, 1.f, 1.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 3, 90.f);
+
+	// Sectors are laid out counter-clockwise, so clockwise steps to the previous index
+	CHECK(Table.GetNeighbour(0, false) == 1);
+	CHECK(Table.GetNeighbour(1, false) == 2);
+	CHECK(Table.GetNeighbour(2, false) == 0);
+	CHECK(Table.GetNeighbour(0, true) == 2);
+	CHECK(Table.GetNeighbour(2, true) == 1);
+	CHECK(Table.GetNeighbour(1, true) == 0);
+
+	// Start from the first sector when nothing is selected
+	CHECK(Table.GetNeighbour(-1, true) == 0);
+	CHECK(Table.GetNeighbour(3, false) == 0);
+
+	// A single sector is its own neighbour
+	Table.Build(Weights, 1, 0.f);
+	CHECK(Table.GetNeighbour(0, true) == 0);
+	CHECK(Table.GetNeighbour(0, false) == 0);
+}
+
+static void TestGetSectorInDirection()
+{
+	const float Weights[] = { 1.f, 1.f, 1.f, 1.f };
+
+	FSectorTable Table;
+	Table.Build(Weights, 4, 90.f);
+
+	// Sector 0 is up, 1 left, 2 down and 3 right
+	CHECK(Table.GetSectorInDirection(0) == 3);
+	CHECK(Table.GetSectorInDirection(2) == 0);
+	CHECK(Table.GetSectorInDirection(4) == 1);
+	CHECK(Table.GetSectorInDirection(6) == 2);
+
+	// Diagonals fall on the sector boundary and go to the next sector counter-clockwise
+	CHECK(Table.GetSectorInDirection(1) == 0);
+	CHECK(Table.GetSectorInDirection(7) == 3);
+
+	CHECK(Table.GetSectorInDirection(-1) == -1);
+	CHECK(Table.GetSectorInDirection(FSectorTable::NumDirections) == -1);
+
+	for (int32_t DirectionIndex = 0; DirectionIndex < FSectorTable::NumDirections; ++DirectionIndex)
+	{
+		CHECK(Table.GetSectorInDirection(DirectionIndex) == Table.FindSector(DirectionIndex * 45.f));
+	}
+}
+
+static void TestAngles()
+{
+	CHECK(IsNearlyEqual(ClampAxis(-90.f), 270.f));
+	CHECK(IsNearlyEqual(ClampAxis(720.f), 0.f));
+	CHECK(IsNearlyEqual(NormalizeAxis(270.f), -90.f));
+	CHECK(IsNearlyEqual(NormalizeAxis(180.f), 180.f));
+
+	CHECK(IsNearlyEqual(VectorToAngle(FVec2(1.f, 0.f)), 0.f));
+	CHECK(IsNearlyEqual(VectorToAngle(FVec2(0.f, -1.f)), 90.f));
+	CHECK(IsNearlyEqual(VectorToAngle(FVec2(-1.f, 0.f)), 180.f));
+	CHECK(IsNearlyEqual(VectorToAngle(FVec2(0.f, 1.f)), 270.f));
+
+	for (int32_t Angle = 0; Angle < 360; Angle += 15)
+	{
+		CHECK(IsNearlyEqualAngle(VectorToAngle(AngleToDirection(static_cast<float>(Angle))), static_cast<float>(Angle)));
+	}
+}
+
+static void TestApplyDeadzone()
+{
+	// Inside of the deadzone
+	const FVec2 Inside = ApplyDeadzone(FVec2(0.1f, -0.1f), 0.25f);
+	CHECK(IsNearlyEqual(Inside.X, 0.f) && IsNearlyEqual(Inside.Y, 0.f));
+
+	const FVec2 Zero = ApplyDeadzone(FVec2(), 0.25f);
+	CHECK(IsNearlyEqual(Zero.X, 0.f) && IsNearlyEqual(Zero.Y, 0.f));
+
+	// The remaining range is rescaled and keeps the direction
+	const FVec2 Half = ApplyDeadzone(FVec2(0.f, -0.625f), 0.25f);
+	CHECK(IsNearlyEqual(Half.X, 0.f) && IsNearlyEqual(Half.Y, -0.5f));
+
+	const FVec2 Full = ApplyDeadzone(FVec2(-0.6f, 0.8f), 0.25f);
+	CHECK(IsNearlyEqual(Full.Size(), 1.f));
+	CHECK(IsNearlyEqualAngle(VectorToAngle(Full), VectorToAngle(FVec2(-0.6f, 0.8f))));
+
+	// Without a deadzone the value is unchanged
+	const FVec2 Unchanged = ApplyDeadzone(FVec2(0.3f, 0.4f), 0.f);
+	CHECK(IsNearlyEqual(Unchanged.X, 0.3f) && IsNearlyEqual(Unchanged.Y, 0.4f));
+}
+
+static void TestInterpAngleTo()
+{
+	// Without speed the target is reached at once
+	CHECK(IsNearlyEqual(InterpAngleTo(10.f, 100.f, 0.016f, 0.f), 100.f));
+
+	CHECK(IsNearlyEqual(InterpAngleTo(0.f, 90.f, 0.5f, 1.f), 45.f));
+
+	// The shortest way goes across 0/360
+	CHECK(IsNearlyEqual(InterpAngleTo(350.f, 10.f, 0.5f, 1.f), 0.f));
+	CHECK(IsNearlyEqual(InterpAngleTo(10.f, 350.f, 0.25f, 1.f), 5.f));
+	CHECK(IsNearlyEqual(InterpAngleTo(10.f, 330.f, 0.75f, 1.f), 340.f));
+
+	// Never overshoots
+	CHECK(IsNearlyEqual(InterpAngleTo(0.f, 90.f, 10.f, 1.f), 90.f));
+
+	// The result stays in [0, 360)
+	const float Result = InterpAngleTo(-20.f, 700.f, 0.1f, 1.f);
+	CHECK(Result >= 0.f && Result < 360.f);
+}
+
+static void TestComputeDesiredWidth()
+{
+	// Four sectors of 90 degrees: the chord of a 50 unit child is 50 / (2 * sin(45)) away from the centre
+	const float CenterDistance = 50.f / (2.f * std::sin(DegreesToRadians(45.f)));
+
+	CHECK(IsNearlyEqual(ComputeDesiredWidth(90.f, FVec2(50.f, 50.f), 1.f), 2.f * CenterDistance + 50.f));
+	CHECK(IsNearlyEqual(ComputeDesiredWidth(90.f, FVec2(50.f, 50.f), 0.5f), 4.f * (CenterDistance + 25.f)));
+
+	// Without a preferred radius the child only needs to stay inside of the panel
+	CHECK(IsNearlyEqual(ComputeDesiredWidth(90.f, FVec2(50.f, 50.f), 0.f), 2.f * CenterDistance + 50.f));
+
+	// The largest side decides the spacing
+	CHECK(IsNearlyEqual(ComputeDesiredWidth(90.f, FVec2(50.f, 20.f), 0.f), ComputeDesiredWidth(90.f, FVec2(20.f, 50.f), 0.f)));
+
+	// Narrower sectors need more room, a single sector is clamped to a half circle
+	CHECK(ComputeDesiredWidth(30.f, FVec2(50.f, 50.f), 1.f) > ComputeDesiredWidth(90.f, FVec2(50.f, 50.f), 1.f));
+	CHECK(IsNearlyEqual(ComputeDesiredWidth(360.f, FVec2(50.f, 50.f), 0.f), 100.f));
+
+	// A sector without width does not divide by zero
+	const float Degenerate = ComputeDesiredWidth(0.f, FVec2(50.f, 50.f), 1.f);
+	CHECK(std::isfinite(Degenerate) && Degenerate > 0.f);
+}
+
+static void TestPlaceSlots()
+{
+	// The nearest side of the child touches the circle from the inside
+	const FSlotPlacement Placement = PlaceSlot(FVec2(1.f, 0.f), 100.f, 100.f, FVec2(40.f, 20.f));
+	CHECK(IsNearlyEqual(Placement.Offset.X, 90.f + 100.f - 20.f));
+	CHECK(IsNearlyEqual(Placement.Offset.Y, 100.f - 10.f));
+	CHECK(IsNearlyEqual(Placement.Size.X, 40.f) && IsNearlyEqual(Placement.Size.Y, 20.f));
+
+	const float Angles[] = { 0.f, 90.f, 180.f, 270.f, 33.f };
+	const float SizesX[] = { 10.f, 20.f, 30.f, 40.f, 50.f };
+	const float SizesY[] = { 50.f, 40.f, 30.f, 20.f, 10.f };
+	float DirectionsX[5];
+	float DirectionsY[5];
+	float OffsetsX[5];
+	float OffsetsY[5];
+
+	ComputeDirections(Angles, DirectionsX, DirectionsY, 5);
+	PlaceSlots(DirectionsX, DirectionsY, SizesX, SizesY, 80.f, 80.f, OffsetsX, OffsetsY, 5);
+
+	for (int32_t Index = 0; Index < 5; ++Index)
+	{
+		const FVec2 Direction = AngleToDirection(Angles[Index]);
+		CHECK(IsNearlyEqual(DirectionsX[Index], Direction.X) && IsNearlyEqual(DirectionsY[Index], Direction.Y));
+
+		const FSlotPlacement Expected = PlaceSlot(Direction, 80.f, 80.f, FVec2(SizesX[Index], SizesY[Index]));
+		CHECK(IsNearlyEqual(OffsetsX[Index], Expected.Offset.X) && IsNearlyEqual(OffsetsY[Index], Expected.Offset.Y));
+	}
+}
+
+static void TestAssignRings()
+{
+	CHECK(AssignRings(0, 8, 4).empty());
+	CHECK(AssignRings(-3, 8, 4).empty());
+
+	// 8 in the first ring, 12 in the second, the rest in the third
+	const std::vector<FRingAssignment> Rings = AssignRings(25, 8, 4);
+	CHECK(Rings.size() == 25);
+
+	for (int32_t Index = 0; Index < 25; ++Index)
+	{
+		const FRingAssignment& Assignment = Rings[Index];
+		const int32_t ExpectedRing = Index < 8 ? 0 : Index < 20 ? 1 : 2;
+		const int32_t ExpectedStart = ExpectedRing == 0 ? 0 : ExpectedRing == 1 ? 8 : 20;
+		const int32_t ExpectedNum = ExpectedRing == 0 ? 8 : ExpectedRing == 1 ? 12 : 5;
+
+		CHECK(Assignment.Ring == ExpectedRing);
+		CHECK(Assignment.IndexInRing == Index - ExpectedStart);
+		CHECK(Assignment.NumInRing == ExpectedNum);
+	}
+
+	// Fewer slots than the first ring holds
+	const std::vector<FRingAssignment> Single = AssignRings(3, 8, 4);
+	CHECK(Single.size() == 3 && Single[2].Ring == 0 && Single[2].IndexInRing == 2 && Single[2].NumInRing == 3);
+
+	// Capacity never drops below one, even when rings shrink
+	const std::vector<FRingAssignment> Shrinking = AssignRings(6, 3, -2);
+	CHECK(Shrinking[2].Ring == 0 && Shrinking[2].NumInRing == 3);
+	CHECK(Shrinking[3].Ring == 1 && Shrinking[3].NumInRing == 1);
+	CHECK(Shrinking[4].Ring == 2 && Shrinking[5].Ring == 3);
+
+	const std::vector<FRingAssignment> ZeroCapacity = AssignRings(2, 0, 0);
+	CHECK(ZeroCapacity[0].Ring == 0 && ZeroCapacity[1].Ring == 1);
+}
+
+static void TestMouseAnalogAccumulator()
+{
+	FMouseAnalogAccumulator Accumulator;
+	Accumulator.Threshold = 10.f;
+
+	FVec2 AnalogValue;
+	CHECK(!Accumulator.Update(FVec2(5.f, 0.f), FVec2(), AnalogValue));
+	CHECK(Accumulator.Update(FVec2(12.f, 0.f), FVec2(), AnalogValue));
+	CHECK(IsNearlyEqual(AnalogValue.X, 1.f) && IsNearlyEqual(AnalogValue.Y, 0.f));
+
+	// Blended with the current direction
+	CHECK(Accumulator.Update(FVec2(12.f, -11.f), AnalogValue, AnalogValue));
+	CHECK(IsNearlyEqualAngle(VectorToAngle(AnalogValue), 45.f));
+}
+
+int main()
+{
+	TestBuildEqualSectors();
+	TestBuildEmpty();
+	TestBuildWeightedSectors();
+	TestZeroWeightSectors();
+	TestTrailingZeroWeightSectors();
+	TestFindSectorWrapAround();
+	TestFindSectorWithHysteresis();
+	TestGetNeighbour();
+	TestGetSectorInDirection();
+	TestAngles();
+	TestApplyDeadzone();
+	TestInterpAngleTo();
+	TestComputeDesiredWidth();
+	TestPlaceSlots();
+	TestAssignRings();
+	TestMouseAnalogAccumulator();
+
+	if (NumFailures > 0)
+	{
+		std::fprintf(stderr, "%d check(s) failed\n", NumFailures);
+		return 1;
+	}
+
+	std::printf("All radial menu core tests passed\n");
+	return 0;
+}